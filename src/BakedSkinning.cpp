@@ -0,0 +1,238 @@
+// Copyright (C) Remedy Entertainment Plc.
+
+#include "BakedSkinning.h"
+
+#include "PrecompiledHeader.h"
+
+DIAGNOSTIC_PUSH
+IGNORE_USD_WARNINGS
+#include <pxr/base/gf/matrix3d.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/work/loops.h>
+DIAGNOSTIC_POP
+
+#include <algorithm>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace
+{
+	constexpr size_t POINT_TRANSFORM_SIZE = 12;
+	constexpr size_t NORMAL_TRANSFORM_SIZE = 9;
+
+	/// Weighted sum of the transforms of \p numInfluences influences, false when none of them has any weight
+	template< size_t N >
+	bool blendTransforms( const float* transforms, const int* indices, const float* weights, int numInfluences, float* blended )
+	{
+		std::fill_n( blended, N, 0.0f );
+		float totalWeight = 0.0f;
+		for( int influence = 0; influence < numInfluences; ++influence )
+		{
+			const float weight = weights[ influence ];
+			const float* transform = transforms + static_cast< size_t >( indices[ influence ] ) * N;
+			for( size_t i = 0; i < N; ++i )
+			{
+				blended[ i ] += weight * transform[ i ];
+			}
+			totalWeight += weight;
+		}
+		return totalWeight > 0.0f;
+	}
+} // namespace
+
+remedy::BakedSkinning::BakedSkinning(
+	VtVec3fArray restPoints,
+	VtVec3fArray restNormals,
+	VtIntArray normalPoints,
+	VtIntArray jointIndices,
+	VtFloatArray jointWeights,
+	int influencesPerPoint )
+	: m_restPoints( std::move( restPoints ) )
+	, m_restNormals( std::move( restNormals ) )
+	, m_normalPoints( std::move( normalPoints ) )
+	, m_jointIndices( std::move( jointIndices ) )
+	, m_jointWeights( std::move( jointWeights ) )
+	, m_influencesPerPoint( influencesPerPoint )
+{
+	if( m_restNormals.size() != m_normalPoints.size() )
+	{
+		m_restNormals.clear();
+		m_normalPoints.clear();
+	}
+}
+
+void remedy::BakedSkinning::AddFrame( double time, const std::vector< GfMatrix4d >& skinningTransforms )
+{
+	if( m_times.empty() )
+	{
+		m_numInfluences = skinningTransforms.size();
+	}
+	if( !TF_VERIFY( skinningTransforms.size() == m_numInfluences ) )
+	{
+		return;
+	}
+
+	m_times.push_back( time );
+	m_pointTransforms.reserve( m_times.size() * m_numInfluences * POINT_TRANSFORM_SIZE );
+	m_normalTransforms.reserve( m_times.size() * m_numInfluences * NORMAL_TRANSFORM_SIZE );
+	for( const GfMatrix4d& transform : skinningTransforms )
+	{
+		for( int row = 0; row < 4; ++row )
+		{
+			for( int column = 0; column < 3; ++column )
+			{
+				m_pointTransforms.push_back( static_cast< float >( transform[ row ][ column ] ) );
+			}
+		}
+
+		// Normals are row vectors too, they transform by the inverse transpose of the linear part
+		const GfMatrix3d normalTransform = transform.ExtractRotationMatrix().GetInverse().GetTranspose();
+		for( int row = 0; row < 3; ++row )
+		{
+			for( int column = 0; column < 3; ++column )
+			{
+				m_normalTransforms.push_back( static_cast< float >( normalTransform[ row ][ column ] ) );
+			}
+		}
+	}
+}
+
+VtVec3fArray remedy::BakedSkinning::ComputePoints( size_t frameIndex ) const
+{
+	TRACE_FUNCTION()
+
+	const size_t numPoints = m_restPoints.size();
+	if( m_influencesPerPoint == 0 || m_jointIndices.size() != numPoints * static_cast< size_t >( m_influencesPerPoint ) )
+	{
+		return m_restPoints;
+	}
+
+	const float* transforms = m_pointTransforms.data() + frameIndex * m_numInfluences * POINT_TRANSFORM_SIZE;
+	const GfVec3f* restPoints = m_restPoints.cdata();
+	const int* jointIndices = m_jointIndices.cdata();
+	const float* jointWeights = m_jointWeights.cdata();
+	VtVec3fArray points( numPoints );
+	GfVec3f* pointsData = points.data();
+	WorkParallelForN(
+		numPoints,
+		[ & ]( size_t begin, size_t end )
+		{
+			float m[ POINT_TRANSFORM_SIZE ];
+			for( size_t point = begin; point < end; ++point )
+			{
+				const size_t offset = point * m_influencesPerPoint;
+				const GfVec3f& p = restPoints[ point ];
+				if( !blendTransforms< POINT_TRANSFORM_SIZE >(
+						transforms,
+						jointIndices + offset,
+						jointWeights + offset,
+						m_influencesPerPoint,
+						m ) )
+				{
+					pointsData[ point ] = p;
+					continue;
+				}
+
+				pointsData[ point ] = GfVec3f(
+					p[ 0 ] * m[ 0 ] + p[ 1 ] * m[ 3 ] + p[ 2 ] * m[ 6 ] + m[ 9 ],
+					p[ 0 ] * m[ 1 ] + p[ 1 ] * m[ 4 ] + p[ 2 ] * m[ 7 ] + m[ 10 ],
+					p[ 0 ] * m[ 2 ] + p[ 1 ] * m[ 5 ] + p[ 2 ] * m[ 8 ] + m[ 11 ] );
+			}
+		} );
+	return points;
+}
+
+VtVec3fArray remedy::BakedSkinning::ComputeNormals( size_t frameIndex ) const
+{
+	TRACE_FUNCTION()
+
+	const size_t numPoints = m_restPoints.size();
+	if( m_influencesPerPoint == 0 || m_jointIndices.size() != numPoints * static_cast< size_t >( m_influencesPerPoint ) )
+	{
+		return m_restNormals;
+	}
+
+	// Face varying normals share the transform of their point, blend it once per point and then apply it per normal.
+	// Points without any weight keep an identity transform
+	const float* transforms = m_normalTransforms.data() + frameIndex * m_numInfluences * NORMAL_TRANSFORM_SIZE;
+	const int* jointIndices = m_jointIndices.cdata();
+	const float* jointWeights = m_jointWeights.cdata();
+	std::vector< float > pointTransforms( numPoints * NORMAL_TRANSFORM_SIZE );
+	WorkParallelForN(
+		numPoints,
+		[ & ]( size_t begin, size_t end )
+		{
+			for( size_t point = begin; point < end; ++point )
+			{
+				const size_t offset = point * m_influencesPerPoint;
+				float* m = pointTransforms.data() + point * NORMAL_TRANSFORM_SIZE;
+				if( !blendTransforms< NORMAL_TRANSFORM_SIZE >(
+						transforms,
+						jointIndices + offset,
+						jointWeights + offset,
+						m_influencesPerPoint,
+						m ) )
+				{
+					m[ 0 ] = m[ 4 ] = m[ 8 ] = 1.0f;
+				}
+			}
+		} );
+
+	VtVec3fArray normals( m_restNormals.size() );
+	const GfVec3f* restNormals = m_restNormals.cdata();
+	const int* normalPoints = m_normalPoints.cdata();
+	GfVec3f* normalsData = normals.data();
+	WorkParallelForN(
+		m_restNormals.size(),
+		[ & ]( size_t begin, size_t end )
+		{
+			for( size_t normal = begin; normal < end; ++normal )
+			{
+				const float* m = pointTransforms.data() + static_cast< size_t >( normalPoints[ normal ] ) * NORMAL_TRANSFORM_SIZE;
+				const GfVec3f& n = restNormals[ normal ];
+				const GfVec3f skinned(
+					n[ 0 ] * m[ 0 ] + n[ 1 ] * m[ 3 ] + n[ 2 ] * m[ 6 ],
+					n[ 0 ] * m[ 1 ] + n[ 1 ] * m[ 4 ] + n[ 2 ] * m[ 7 ],
+					n[ 0 ] * m[ 2 ] + n[ 1 ] * m[ 5 ] + n[ 2 ] * m[ 8 ] );
+				normalsData[ normal ] = skinned.GetNormalized();
+			}
+		} );
+	return normals;
+}
+
+remedy::BakedSkinningSamples::BakedSkinningSamples( std::shared_ptr< const BakedSkinning > skinning, Channel channel )
+	: m_skinning( std::move( skinning ) )
+	, m_channel( channel )
+	, m_cache( channel == Channel::Points ? "skinned points" : "skinned normals" )
+{
+}
+
+const std::vector< double >& remedy::BakedSkinningSamples::GetTimes() const
+{
+	return m_skinning->GetTimes();
+}
+
+bool remedy::BakedSkinningSamples::Get( double time, VtValue* value ) const
+{
+	const auto& times = m_skinning->GetTimes();
+	const auto timeIt = std::lower_bound( times.cbegin(), times.cend(), time );
+	if( timeIt == times.cend() || *timeIt != time )
+	{
+		return false;
+	}
+
+	if( value == nullptr )
+	{
+		return true;
+	}
+
+	const auto frameIndex = static_cast< size_t >( std::distance( times.cbegin(), timeIt ) );
+	*value = m_cache.Get(
+		frameIndex,
+		[ this ]( size_t frame )
+		{
+			return m_channel == Channel::Points ? VtValue( m_skinning->ComputePoints( frame ) )
+												: VtValue( m_skinning->ComputeNormals( frame ) );
+		} );
+	return true;
+}
@@ -0,0 +1,95 @@
+// Copyright (C) Remedy Entertainment Plc.
+
+#pragma once
+
+#include "TimeSampleCache.h"
+#include "UsdFbxDataReader.h"
+
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/pxr.h>
+
+#include <memory>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace remedy
+{
+	/// Linear blend skinning of a single mesh, for consumers that want deformed points rather than a UsdSkel binding.
+	///
+	/// Only the skinning transforms are stored per frame, one per influence, the points and normals of a frame are
+	/// computed when they are asked for. The kernels run over chunks of control points in parallel. Per control point
+	/// the transforms of its influences are blended into a single 3x4 matrix first, which is then applied once. Both
+	/// steps are plain float multiply-adds over fixed size arrays so the compiler can vectorize them.
+	///
+	/// Frames are added in time order through AddFrame.
+	class BakedSkinning
+	{
+	public:
+		/// \p jointIndices and \p jointWeights are padded to \p influencesPerPoint per rest point, as UsdSkel expects them.
+		/// \p normalPoints maps every (face varying) rest normal to the rest point it is skinned with.
+		BakedSkinning(
+			VtVec3fArray restPoints,
+			VtVec3fArray restNormals,
+			VtIntArray normalPoints,
+			VtIntArray jointIndices,
+			VtFloatArray jointWeights,
+			int influencesPerPoint );
+
+		/// \p skinningTransforms take rest points into the space of the mesh at \p time, one per influence
+		void AddFrame( double time, const std::vector< GfMatrix4d >& skinningTransforms );
+
+		[[nodiscard]] VtVec3fArray ComputePoints( size_t frameIndex ) const;
+		[[nodiscard]] VtVec3fArray ComputeNormals( size_t frameIndex ) const;
+
+		[[nodiscard]] const std::vector< double >& GetTimes() const
+		{
+			return m_times;
+		}
+
+		[[nodiscard]] bool HasNormals() const
+		{
+			return !m_restNormals.empty();
+		}
+
+	private:
+		VtVec3fArray m_restPoints;
+		VtVec3fArray m_restNormals;
+		VtIntArray m_normalPoints;
+		VtIntArray m_jointIndices;
+		VtFloatArray m_jointWeights;
+		int m_influencesPerPoint;
+		size_t m_numInfluences = 0;
+
+		std::vector< double > m_times;
+
+		// [frame][influence], the upper 4x3 of the Gf matrices in row-major order
+		std::vector< float > m_pointTransforms;
+
+		// [frame][influence], the inverse transpose of the upper 3x3, row-major
+		std::vector< float > m_normalTransforms;
+	};
+
+	/// Serves the points or normals of a BakedSkinning as time samples. Only the last few frames are kept around,
+	/// playback tends to request the same frame several times in a row.
+	class BakedSkinningSamples : public UsdFbxDataReader::TimeSampleSource
+	{
+	public:
+		enum class Channel
+		{
+			Points,
+			Normals
+		};
+
+		BakedSkinningSamples( std::shared_ptr< const BakedSkinning > skinning, Channel channel );
+
+		[[nodiscard]] const std::vector< double >& GetTimes() const override;
+		[[nodiscard]] bool Get( double time, VtValue* value ) const override;
+
+	private:
+		std::shared_ptr< const BakedSkinning > m_skinning;
+		Channel m_channel;
+		mutable TimeSampleCache< VtValue > m_cache;
+	};
+} // namespace remedy
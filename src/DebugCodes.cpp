@@ -13,4 +13,5 @@ TF_REGISTRY_FUNCTION( TfDebug )
 {
 	TF_DEBUG_ENVIRONMENT_SYMBOL( USDFBX, "UsdFbx debug logging for generic operations" )
 	TF_DEBUG_ENVIRONMENT_SYMBOL( USDFBX_FBX_READERS, "UsdFbx debug logging for any FbxNode readers" )
+	TF_DEBUG_ENVIRONMENT_SYMBOL( USDFBX_PERF, "UsdFbx timings and memory statistics for conversion steps" )
 }
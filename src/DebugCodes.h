@@ -9,7 +9,8 @@ PXR_NAMESPACE_OPEN_SCOPE
 TF_DEBUG_CODES(
 
 	USDFBX,
-	USDFBX_FBX_READERS
+	USDFBX_FBX_READERS,
+	USDFBX_PERF
 
 );
 
@@ -7,6 +7,7 @@ enum class UsdFbxError
 	// FBX related
 	FBX_UNABLE_TO_OPEN,
 	FBX_INCOMPATIBLE_VERSIONS,
+	FBX_UNKNOWN_TAKE,
 
 	// USDFBX plugin related
 	USDFBX_INVALID_LAYER,
@@ -0,0 +1,144 @@
+// Copyright (C) Remedy Entertainment Plc.
+
+#include "FbxAnimatedChannelIndex.h"
+
+#include "DebugCodes.h"
+#include "PrecompiledHeader.h"
+
+DIAGNOSTIC_PUSH
+IGNORE_USD_WARNINGS
+#include <pxr/base/trace/trace.h>
+DIAGNOSTIC_POP
+
+#include <algorithm>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace
+{
+	bool hasCurves( const FbxAnimCurveNode* curveNode )
+	{
+		for( unsigned channelId = 0u; channelId < curveNode->GetChannelsCount(); ++channelId )
+		{
+			if( curveNode->GetCurve( channelId ) != nullptr )
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/// True when \p curve evaluates to the value of its first key everywhere
+	bool isConstant( FbxAnimCurve* curve )
+	{
+		const int numKeys = curve->KeyGetCount();
+		for( int key = 1; key < numKeys; ++key )
+		{
+			if( curve->KeyGetValue( key ) != curve->KeyGetValue( 0 ) )
+			{
+				return false;
+			}
+
+			// Cubic segments between equal keys can still overshoot when their tangents are not flat
+			if( curve->KeyGetInterpolation( key - 1 ) == FbxAnimCurveDef::eInterpolationCubic
+				&& ( curve->KeyGetRightDerivative( key - 1 ) != 0.0f || curve->KeyGetLeftDerivative( key ) != 0.0f ) )
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+} // namespace
+
+remedy::FbxAnimatedChannelIndex::FbxAnimatedChannelIndex( FbxAnimStack* animStack )
+{
+	TRACE_FUNCTION()
+
+	if( animStack == nullptr )
+	{
+		return;
+	}
+
+	for( int layerId = 0, numLayers = animStack->GetMemberCount< FbxAnimLayer >(); layerId < numLayers; ++layerId )
+	{
+		m_animLayers.push_back( animStack->GetMember< FbxAnimLayer >( layerId ) );
+	}
+
+	size_t numChannels = 0;
+	for( FbxAnimLayer* animLayer : m_animLayers )
+	{
+		for( int curveNodeId = 0, n = animLayer->GetMemberCount< FbxAnimCurveNode >(); curveNodeId < n; ++curveNodeId )
+		{
+			FbxAnimCurveNode* curveNode = animLayer->GetMember< FbxAnimCurveNode >( curveNodeId );
+			if( curveNode == nullptr || !hasCurves( curveNode ) )
+			{
+				continue;
+			}
+
+			for( int propertyId = 0, numProperties = curveNode->GetDstPropertyCount(); propertyId < numProperties; ++propertyId )
+			{
+				const FbxProperty property = curveNode->GetDstProperty( propertyId );
+				if( GetCurveNode( property ) == nullptr )
+				{
+					add( property, curveNode );
+					++numChannels;
+				}
+			}
+		}
+	}
+
+	TF_DEBUG( USDFBX_PERF )
+		.Msg(
+			"UsdFbx - Indexed %zu animated properties on %zu objects over %zu anim layers\n",
+			numChannels,
+			m_channels.size(),
+			m_animLayers.size() );
+}
+
+FbxAnimCurveNode* remedy::FbxAnimatedChannelIndex::GetCurveNode( const FbxProperty& property ) const
+{
+	const auto it = m_channels.find( property.GetFbxObject() );
+	if( it == m_channels.end() )
+	{
+		return nullptr;
+	}
+
+	const auto channelIt = std::find_if(
+		it->second.cbegin(),
+		it->second.cend(),
+		[ & ]( const Channel& channel ) { return channel.property == property; } );
+	return channelIt != it->second.cend() ? channelIt->curveNode : nullptr;
+}
+
+bool remedy::FbxAnimatedChannelIndex::IsConstant( const FbxProperty& property ) const
+{
+	FbxAnimCurveNode* curveNode = GetCurveNode( property );
+	if( curveNode == nullptr )
+	{
+		return true;
+	}
+	if( IsLayered() )
+	{
+		return false;
+	}
+
+	for( unsigned channelId = 0u; channelId < curveNode->GetChannelsCount(); ++channelId )
+	{
+		for( int curveId = 0, n = curveNode->GetCurveCount( channelId ); curveId < n; ++curveId )
+		{
+			if( !isConstant( curveNode->GetCurve( channelId, curveId ) ) )
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+void remedy::FbxAnimatedChannelIndex::add( const FbxProperty& property, FbxAnimCurveNode* curveNode )
+{
+	if( property.IsValid() && property.GetFbxObject() != nullptr )
+	{
+		m_channels[ property.GetFbxObject() ].push_back( { property, curveNode } );
+	}
+}
@@ -0,0 +1,65 @@
+// Copyright (C) Remedy Entertainment Plc.
+
+#pragma once
+
+#include <fbxsdk.h>
+
+#include <unordered_map>
+#include <vector>
+
+namespace remedy
+{
+	/// Maps every animated property of a scene to a curve node driving it in an anim stack.
+	///
+	/// Built once from the curve nodes of the layers of the stack, so readers can tell static objects apart in a
+	/// single lookup instead of asking every property of every node for its curve node. When a property is animated
+	/// on several layers the curve node of the first one is kept, the value itself has to come from the evaluator.
+	class FbxAnimatedChannelIndex
+	{
+	public:
+		FbxAnimatedChannelIndex() = default;
+		explicit FbxAnimatedChannelIndex( FbxAnimStack* animStack );
+
+		/// Returns true when any property of \p object is animated
+		[[nodiscard]] bool IsAnimated( const FbxObject* object ) const
+		{
+			return m_channels.find( object ) != m_channels.end();
+		}
+
+		[[nodiscard]] bool IsAnimated( const FbxProperty& property ) const
+		{
+			return GetCurveNode( property ) != nullptr;
+		}
+
+		/// Returns the curve node driving \p property, or \c nullptr when it has no curves to evaluate
+		[[nodiscard]] FbxAnimCurveNode* GetCurveNode( const FbxProperty& property ) const;
+
+		/// Returns true when \p property has no curves, or none of its curves ever leave the value of their first key.
+		/// The constant value can still differ from the static value of the property.
+		/// On a layered stack animated properties never count as constant, the evaluator blends their layers.
+		[[nodiscard]] bool IsConstant( const FbxProperty& property ) const;
+
+		/// Returns true when the stack has more than one layer, their curves then have to be blended
+		[[nodiscard]] bool IsLayered() const
+		{
+			return m_animLayers.size() > 1;
+		}
+
+		[[nodiscard]] size_t GetNumAnimatedObjects() const
+		{
+			return m_channels.size();
+		}
+
+	private:
+		struct Channel
+		{
+			FbxProperty property;
+			FbxAnimCurveNode* curveNode;
+		};
+
+		void add( const FbxProperty& property, FbxAnimCurveNode* curveNode );
+
+		std::vector< FbxAnimLayer* > m_animLayers;
+		std::unordered_map< const FbxObject*, std::vector< Channel > > m_channels;
+	};
+} // namespace remedy
@@ -0,0 +1,80 @@
+// Copyright (C) Remedy Entertainment Plc.
+
+#include "FbxAnimationSampler.h"
+
+#include "DebugCodes.h"
+#include "PrecompiledHeader.h"
+
+DIAGNOSTIC_PUSH
+IGNORE_USD_WARNINGS
+#include <pxr/base/tf/stopwatch.h>
+#include <pxr/base/trace/trace.h>
+DIAGNOSTIC_POP
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+void remedy::FbxAnimationSampler::AddChannel( Property& property, SampleFn&& sampleFn )
+{
+	m_propertyChannels.push_back( { &property, std::move( sampleFn ) } );
+}
+
+void remedy::FbxAnimationSampler::AddChannel( FrameFn&& frameFn, FinalizeFn&& finalizeFn )
+{
+	m_frameChannels.push_back( { std::move( frameFn ), std::move( finalizeFn ) } );
+}
+
+void remedy::FbxAnimationSampler::Sample( const FbxTimeSpan& timeSpan )
+{
+	TRACE_FUNCTION()
+
+	if( IsEmpty() )
+	{
+		return;
+	}
+
+	const FbxLongLong firstFrame = timeSpan.GetStart().GetFrameCount();
+	const FbxLongLong lastFrame = timeSpan.GetStop().GetFrameCount();
+	const size_t numFrames = lastFrame >= firstFrame ? static_cast< size_t >( lastFrame - firstFrame + 1 ) : 0;
+	for( PropertyChannel& channel : m_propertyChannels )
+	{
+		channel.property->timeSamples.reserve( channel.property->timeSamples.size() + numFrames );
+	}
+
+	TfStopwatch stopwatch;
+	stopwatch.Start();
+	for( FbxLongLong frame = firstFrame; frame <= lastFrame; ++frame )
+	{
+		FbxTime time;
+		time.SetFrame( frame );
+		const UsdTimeCode timeCode( static_cast< double >( frame ) );
+
+		for( PropertyChannel& channel : m_propertyChannels )
+		{
+			channel.property->timeSamples.emplace_back( timeCode, channel.sampleFn( time ) );
+		}
+		for( FrameChannel& channel : m_frameChannels )
+		{
+			channel.frameFn( time, timeCode );
+		}
+	}
+
+	for( FrameChannel& channel : m_frameChannels )
+	{
+		if( channel.finalizeFn )
+		{
+			channel.finalizeFn();
+		}
+	}
+	stopwatch.Stop();
+
+	TF_DEBUG( USDFBX_PERF )
+		.Msg(
+			"UsdFbx - Sampled %zu property channels and %zu frame channels over %zu frames in %.3f ms\n",
+			m_propertyChannels.size(),
+			m_frameChannels.size(),
+			numFrames,
+			stopwatch.GetMilliseconds() );
+
+	m_propertyChannels.clear();
+	m_frameChannels.clear();
+}
@@ -0,0 +1,64 @@
+// Copyright (C) Remedy Entertainment Plc.
+
+#pragma once
+
+#include "UsdFbxDataReader.h"
+
+#include <fbxsdk.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/usd/timeCode.h>
+
+#include <functional>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace remedy
+{
+	/// Samples every animated channel of a scene in a single, frame-major pass.
+	///
+	/// Node readers register their channels while the scene is traversed, Sample then evaluates all of them at
+	/// one frame before moving on to the next. FbxAnimEvaluator caches its results per time, sweeping the whole
+	/// time span channel by channel invalidates those caches for every single channel.
+	/// Sampling is serial, neither FbxAnimEvaluator nor FbxAnimCurve can be shared between threads.
+	class FbxAnimationSampler
+	{
+	public:
+		using Property = UsdFbxDataReader::Property;
+		using SampleFn = std::function< VtValue( FbxTime ) >;
+		using FrameFn = std::function< void( FbxTime, UsdTimeCode ) >;
+		using FinalizeFn = std::function< void() >;
+
+		/// Appends the value of \p sampleFn at every frame to the time samples of \p property.
+		/// \p property must outlive the call to Sample.
+		void AddChannel( Property& property, SampleFn&& sampleFn );
+
+		/// Calls \p frameFn at every frame and \p finalizeFn once all frames have been sampled. For channels that
+		/// author several properties at once, like the joints of a SkelAnimation.
+		void AddChannel( FrameFn&& frameFn, FinalizeFn&& finalizeFn );
+
+		/// Samples every frame of \p timeSpan and clears the registered channels.
+		void Sample( const FbxTimeSpan& timeSpan );
+
+		[[nodiscard]] bool IsEmpty() const
+		{
+			return m_propertyChannels.empty() && m_frameChannels.empty();
+		}
+
+	private:
+		struct PropertyChannel
+		{
+			Property* property;
+			SampleFn sampleFn;
+		};
+
+		struct FrameChannel
+		{
+			FrameFn frameFn;
+			FinalizeFn finalizeFn;
+		};
+
+		std::vector< PropertyChannel > m_propertyChannels;
+		std::vector< FrameChannel > m_frameChannels;
+	};
+} // namespace remedy
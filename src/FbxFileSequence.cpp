@@ -0,0 +1,147 @@
+// Copyright (C) Remedy Entertainment Plc.
+
+#include "FbxFileSequence.h"
+
+#include "DebugCodes.h"
+#include "PrecompiledHeader.h"
+
+DIAGNOSTIC_PUSH
+IGNORE_USD_WARNINGS
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/trace/trace.h>
+DIAGNOSTIC_POP
+
+#include <algorithm>
+#include <optional>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+remedy::FbxFileSequence::FbxFileSequence( std::vector< std::pair< double, std::string > > files, ReadFrameFn readFrame )
+	: m_readFrame( std::move( readFrame ) )
+	, m_frames( TfStringPrintf( "a %zu frame FBX file sequence", files.size() ), PREFETCH_FRAMES + 2 )
+{
+	m_times.reserve( files.size() );
+	m_paths.reserve( files.size() );
+	for( auto& [ time, path ] : files )
+	{
+		m_times.push_back( time );
+		m_paths.push_back( std::move( path ) );
+	}
+}
+
+remedy::FbxFileSequence::~FbxFileSequence()
+{
+	{
+		std::lock_guard lock( m_mutex );
+		m_isStopping = true;
+	}
+	m_condition.notify_all();
+	if( m_prefetcher.joinable() )
+	{
+		m_prefetcher.join();
+	}
+
+	if( m_numPrefetched > 0 )
+	{
+		TF_DEBUG( USDFBX_PERF ).Msg( "UsdFbx - Read %zu frames of the sequence ahead of the playhead\n", m_numPrefetched );
+	}
+}
+
+std::shared_ptr< const remedy::FbxFileSequence::FramePoints > remedy::FbxFileSequence::GetFrame( size_t frameIndex ) const
+{
+	{
+		std::lock_guard lock( m_mutex );
+
+		// The prefetcher reads ahead of whichever frame was asked for last
+		m_playhead = frameIndex;
+		if( !m_prefetcher.joinable() )
+		{
+			m_prefetcher = std::thread( [ this ]() { prefetch(); } );
+		}
+	}
+	m_condition.notify_all();
+
+	return readFrame( frameIndex );
+}
+
+std::shared_ptr< const remedy::FbxFileSequence::FramePoints > remedy::FbxFileSequence::readFrame( size_t frameIndex ) const
+{
+	return m_frames.Get(
+		frameIndex,
+		[ this ]( size_t frame )
+		{
+			TRACE_FUNCTION()
+			return std::make_shared< const FramePoints >( m_readFrame( m_paths[ frame ] ) );
+		} );
+}
+
+void remedy::FbxFileSequence::prefetch() const
+{
+	std::unique_lock lock( m_mutex );
+	while( !m_isStopping )
+	{
+		std::optional< size_t > nextFrame;
+		for( size_t frameIndex = m_playhead + 1; frameIndex <= m_playhead + PREFETCH_FRAMES && frameIndex < m_times.size();
+			 ++frameIndex )
+		{
+			if( !m_frames.Contains( frameIndex ) )
+			{
+				nextFrame = frameIndex;
+				break;
+			}
+		}
+
+		if( !nextFrame )
+		{
+			m_condition.wait( lock );
+			continue;
+		}
+
+		++m_numPrefetched;
+		lock.unlock();
+		readFrame( *nextFrame );
+		lock.lock();
+	}
+}
+
+remedy::FbxFileSequenceSamples::FbxFileSequenceSamples(
+	std::shared_ptr< const FbxFileSequence > sequence,
+	std::string nodeNamePath,
+	VtVec3fArray restPoints )
+	: m_sequence( std::move( sequence ) )
+	, m_nodeNamePath( std::move( nodeNamePath ) )
+	, m_restPoints( std::move( restPoints ) )
+{
+}
+
+const std::vector< double >& remedy::FbxFileSequenceSamples::GetTimes() const
+{
+	return m_sequence->GetTimes();
+}
+
+bool remedy::FbxFileSequenceSamples::Get( double time, VtValue* value ) const
+{
+	const auto& times = m_sequence->GetTimes();
+	const auto timeIt = std::lower_bound( times.cbegin(), times.cend(), time );
+	if( timeIt == times.cend() || *timeIt != time )
+	{
+		return false;
+	}
+
+	if( value == nullptr )
+	{
+		return true;
+	}
+
+	const auto frame = m_sequence->GetFrame( static_cast< size_t >( std::distance( times.cbegin(), timeIt ) ) );
+	const auto pointsIt = frame->find( m_nodeNamePath );
+	if( pointsIt == frame->end() || pointsIt->second.size() != m_restPoints.size() )
+	{
+		*value = VtValue( m_restPoints );
+		return true;
+	}
+
+	*value = VtValue( pointsIt->second );
+	return true;
+}
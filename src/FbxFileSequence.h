@@ -0,0 +1,95 @@
+// Copyright (C) Remedy Entertainment Plc.
+
+#pragma once
+
+#include "TimeSampleCache.h"
+#include "UsdFbxDataReader.h"
+
+#include <pxr/base/vt/types.h>
+#include <pxr/pxr.h>
+
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace remedy
+{
+	/// Mesh points of a numbered sequence of FBX files, one file per frame (mesh_0001.fbx, mesh_0002.fbx, ...).
+	///
+	/// The first file of the sequence is converted as usual and provides the topology, the points of every frame are
+	/// read from its file when they are asked for. Reading a frame imports a whole FBX file, which the FBX SDK only
+	/// does one file at a time, so a background thread reads ahead of the last requested frame while the current one
+	/// is being played. Only the last few frames are kept around.
+	class FbxFileSequence
+	{
+	public:
+		/// Points of every mesh of a frame, by the name path of its node
+		using FramePoints = std::map< std::string, VtVec3fArray >;
+		using ReadFrameFn = std::function< FramePoints( const std::string& filePath ) >;
+
+		/// \p files are the time codes of the frames and their files, sorted by time
+		FbxFileSequence( std::vector< std::pair< double, std::string > > files, ReadFrameFn readFrame );
+		~FbxFileSequence();
+
+		FbxFileSequence( const FbxFileSequence& ) = delete;
+		FbxFileSequence& operator=( const FbxFileSequence& ) = delete;
+
+		[[nodiscard]] const std::vector< double >& GetTimes() const
+		{
+			return m_times;
+		}
+
+		/// Returns the points of the frame at \p frameIndex, reading its file if needed
+		[[nodiscard]] std::shared_ptr< const FramePoints > GetFrame( size_t frameIndex ) const;
+
+	private:
+		static constexpr size_t PREFETCH_FRAMES = 4;
+
+		/// Reads \p frameIndex unless it is cached, waits for it when it is being read already
+		std::shared_ptr< const FramePoints > readFrame( size_t frameIndex ) const;
+
+		void prefetch() const;
+
+		std::vector< double > m_times;
+		std::vector< std::string > m_paths;
+		ReadFrameFn m_readFrame;
+
+		// Holds the frames read ahead of the playhead, the current frame and the one before it
+		mutable TimeSampleCache< std::shared_ptr< const FramePoints > > m_frames;
+
+		// Guards the playhead and the prefetcher
+		mutable std::mutex m_mutex;
+		mutable std::condition_variable m_condition;
+		mutable size_t m_playhead = 0;
+		mutable bool m_isStopping = false;
+		mutable std::thread m_prefetcher;
+		mutable size_t m_numPrefetched = 0;
+	};
+
+	/// Serves the points of one mesh of an FbxFileSequence as time samples. Frames whose mesh is missing or does not
+	/// match the topology of the first file keep the points of the first file.
+	class FbxFileSequenceSamples : public UsdFbxDataReader::TimeSampleSource
+	{
+	public:
+		/// \p restPoints are the points of the mesh in the first file
+		FbxFileSequenceSamples(
+			std::shared_ptr< const FbxFileSequence > sequence,
+			std::string nodeNamePath,
+			VtVec3fArray restPoints );
+
+		[[nodiscard]] const std::vector< double >& GetTimes() const override;
+		[[nodiscard]] bool Get( double time, VtValue* value ) const override;
+
+	private:
+		std::shared_ptr< const FbxFileSequence > m_sequence;
+		std::string m_nodeNamePath;
+		VtVec3fArray m_restPoints;
+	};
+} // namespace remedy
@@ -0,0 +1,21 @@
+// Copyright (C) Remedy Entertainment Plc.
+
+#include "FbxNodePropertyIndex.h"
+
+remedy::FbxNodePropertyIndex::FbxNodePropertyIndex(
+	const FbxNode* node,
+	const FbxAnimatedChannelIndex& animatedChannels )
+{
+	// Only bother looking up curves when something on the node is animated
+	const bool isNodeAnimated = animatedChannels.IsAnimated( node );
+	for( FbxProperty fbxProperty = node->GetFirstProperty(); fbxProperty.IsValid();
+		 fbxProperty = node->GetNextProperty( fbxProperty ) )
+	{
+		if( !fbxProperty.GetFlag( FbxPropertyFlags::EFlags::eUserDefined ) )
+		{
+			continue;
+		}
+
+		m_userProperties.push_back( { fbxProperty, isNodeAnimated ? animatedChannels.GetCurveNode( fbxProperty ) : nullptr } );
+	}
+}
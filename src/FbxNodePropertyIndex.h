@@ -0,0 +1,37 @@
+// Copyright (C) Remedy Entertainment Plc.
+
+#pragma once
+
+#include "FbxAnimatedChannelIndex.h"
+
+#include <fbxsdk.h>
+
+#include <vector>
+
+namespace remedy
+{
+	/// The user-defined properties of a single node and the curve nodes animating them.
+	///
+	/// Finding user properties means walking every built-in property of the node as well, this is done once per
+	/// node and shared by all of its readers.
+	class FbxNodePropertyIndex
+	{
+	public:
+		struct UserProperty
+		{
+			FbxProperty property;
+			/// \c nullptr when the property is not animated
+			FbxAnimCurveNode* curveNode;
+		};
+
+		FbxNodePropertyIndex( const FbxNode* node, const FbxAnimatedChannelIndex& animatedChannels );
+
+		[[nodiscard]] const std::vector< UserProperty >& GetUserProperties() const
+		{
+			return m_userProperties;
+		}
+
+	private:
+		std::vector< UserProperty > m_userProperties;
+	};
+} // namespace remedy
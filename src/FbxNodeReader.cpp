@@ -2,16 +2,24 @@
 
 #include "FbxNodeReader.h"
 
+#include "BakedSkinning.h"
 #include "DebugCodes.h"
 #include "Helpers.h"
 #include "PrecompiledHeader.h"
+#include "QuantizedSkelAnimation.h"
 #include "Tokens.h"
+#include "VertexCache.h"
 
 #include <algorithm>
+#include <array>
+#include <numeric>
+#include <optional>
 #include <utility>
 
 DIAGNOSTIC_PUSH
 IGNORE_USD_WARNINGS
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/sdf/schema.h>
 #include <pxr/usd/sdr/shaderProperty.h>
 #include <pxr/usd/usd/tokens.h>
@@ -83,6 +91,20 @@ namespace helpers
 				 m[ 2 ][ 0 ], m[ 2 ][ 1 ], m[ 2 ][ 2 ], m[ 2 ][ 3 ], m[ 3 ][ 0 ], m[ 3 ][ 1 ], m[ 3 ][ 2 ], m[ 3 ][ 3 ] };
 	}
 
+	FbxAMatrix toFbxAMatrix( const GfMatrix4d& m )
+	{
+		FbxAMatrix result;
+		FbxDouble4x4& rows = result;
+		for( int row = 0; row < 4; ++row )
+		{
+			for( int column = 0; column < 4; ++column )
+			{
+				rows[ row ][ column ] = m[ row ][ column ];
+			}
+		}
+		return result;
+	}
+
 	inline GfVec3f toGfVec( const FbxVector4& src )
 	{
 		return { static_cast< float >( src[ 0 ] ), static_cast< float >( src[ 1 ] ), static_cast< float >( src[ 2 ] ) };
@@ -141,6 +163,25 @@ namespace helpers
 		return nullptr;
 	}
 
+	/// Sorts the influences of a single control point by decreasing weight. Rows are a handful of influences long, an
+	/// insertion sort keeps the influences and their weights in step without any allocation
+	void sortInfluencesByWeight( int* influences, float* weights, size_t size )
+	{
+		for( size_t i = 1; i < size; ++i )
+		{
+			const int influence = influences[ i ];
+			const float weight = weights[ i ];
+			size_t j = i;
+			for( ; j > 0 && weights[ j - 1 ] < weight; --j )
+			{
+				influences[ j ] = influences[ j - 1 ];
+				weights[ j ] = weights[ j - 1 ];
+			}
+			influences[ j ] = influence;
+			weights[ j ] = weight;
+		}
+	}
+
 	// This isn't particularly nice, but I couldn't make it work with less
 	// boilerplate code via templates either.
 	struct FbxToUsd
@@ -330,134 +371,183 @@ namespace helpers
 		}
 	};
 
-	std::vector< std::tuple< UsdTimeCode, VtValue > > getPropertyAnimation(
-		FbxNode* node,
-		std::function< VtValue( FbxNode*, FbxTime ) >& valueAtTimeFn,
-		FbxAnimLayer* animLayer,
-		FbxTimeSpan& animTimeSpan )
-	{
-		std::vector< std::tuple< UsdTimeCode, VtValue > > result = {};
-		if( animLayer == nullptr )
-		{
-			return result;
-		}
-
-		for( auto frame = animTimeSpan.GetStart().GetFrameCount(); frame <= animTimeSpan.GetStop().GetFrameCount(); ++frame )
-		{
-			FbxTime currentFrame;
-			currentFrame.SetFrame( frame );
-			result.push_back( { UsdTimeCode( static_cast< double >( frame ) ), valueAtTimeFn( node, currentFrame ) } );
-		}
-		return result;
-	}
-
-	std::vector< std::tuple< UsdTimeCode, VtValue > > getPropertyAnimation(
-		FbxNode* node,
-		FbxProperty& fbxProperty,
-		FbxAnimLayer* animLayer,
-		FbxTimeSpan& animTimeSpan )
+	/// Evaluates \p fbxProperty through the scene's evaluator, blending every layer of the current anim stack
+	void evaluateBlendedChannels( FbxProperty& fbxProperty, FbxTime time, std::vector< float >& channelValues )
 	{
-		std::vector< std::tuple< UsdTimeCode, VtValue > > result = {};
-		if( animLayer == nullptr )
+		auto assign = [ & ]( const double* values, size_t count )
 		{
-			return result;
-		}
+			for( size_t channelId = 0; channelId < std::min( count, channelValues.size() ); ++channelId )
+			{
+				channelValues[ channelId ] = static_cast< float >( values[ channelId ] );
+			}
+		};
 
-		if( !fbxProperty.IsValid() )
+		switch( channelValues.size() )
 		{
-			return result;
-		}
-
-		const auto curveNode = node->GetAnimationEvaluator()->GetPropertyCurveNode( fbxProperty, animLayer );
-		if( curveNode == nullptr )
+		case 1:
 		{
-			return result;
+			const FbxDouble value = fbxProperty.EvaluateValue< FbxDouble >( time );
+			assign( &value, 1 );
+			break;
 		}
-
-		bool hasAnimCurves = false;
-		for( unsigned channelId = 0u; channelId < curveNode->GetChannelsCount(); ++channelId )
+		case 2:
+			assign( fbxProperty.EvaluateValue< FbxDouble2 >( time ).mData, 2 );
+			break;
+		case 3:
+			assign( fbxProperty.EvaluateValue< FbxDouble3 >( time ).mData, 3 );
+			break;
+		case 4:
+			assign( fbxProperty.EvaluateValue< FbxDouble4 >( time ).mData, 4 );
+			break;
+		case 16:
 		{
-			if( curveNode->GetCurve( channelId ) != nullptr )
+			const FbxDouble4x4 value = fbxProperty.EvaluateValue< FbxDouble4x4 >( time );
+			for( size_t row = 0; row < 4; ++row )
 			{
-				hasAnimCurves = true;
-				break;
+				for( size_t column = 0; column < 4; ++column )
+				{
+					channelValues[ row * 4 + column ] = static_cast< float >( value.mData[ row ].mData[ column ] );
+				}
 			}
+			break;
 		}
-
-		if( !hasAnimCurves )
-		{
-			return result;
+		default:
+			TF_WARN( "Unable to blend anim layers of \"%s\", unsupported channel count", fbxProperty.GetName().Buffer() );
+			break;
 		}
+	}
 
-		const size_t numKeys = animTimeSpan.GetDuration().GetFrameCount() + 1;
-		const std::vector< float > defaultChannelsValue( curveNode->GetChannelsCount(), 0.0f );
-		std::vector< std::vector< float > > channelValues( numKeys, defaultChannelsValue );
-		std::set< UsdTimeCode > timeCodes;
-
-		for( unsigned channelId = 0u; channelId < curveNode->GetChannelsCount(); ++channelId )
+	/// Returns a function evaluating the curves of \p curveNode and converting them to the Usd value of \p fbxProperty.
+	/// With \p blendLayers the value comes from the evaluator instead, which blends every layer of the anim stack.
+	remedy::FbxAnimationSampler::SampleFn getPropertySampler(
+		FbxProperty fbxProperty,
+		FbxAnimCurveNode* curveNode,
+		bool blendLayers )
+	{
+		// Channels without a curve keep evaluating to 0
+		std::vector< float > channelValues( curveNode->GetChannelsCount(), 0.0f );
+		return [ fbxProperty, curveNode, channelValues, blendLayers ]( FbxTime time ) mutable
 		{
-			// We are assuming a singular FbxAnimCurve per property, it is however
-			// possible to have multiple FbxAnimCurves connected to a singular property
-			// If this is deemed necessary, add support for it, otherwise it can be
-			// ignored for now see curveNode->GetCurveCount()
-			const auto animCurve = curveNode->GetCurve( channelId );
-			if( animCurve == nullptr )
+			if( blendLayers )
 			{
-				continue;
+				evaluateBlendedChannels( fbxProperty, time, channelValues );
+				return FbxToUsd{ &fbxProperty }.getValue( channelValues );
 			}
-			// We can't use keyCount, we have to use Evaluate and step through one frame
-			// at a time
-			size_t index = 0;
-			for( auto frame = animTimeSpan.GetStart().GetFrameCount(); frame <= animTimeSpan.GetStop().GetFrameCount(); ++frame )
+
+			for( unsigned channelId = 0u; channelId < curveNode->GetChannelsCount(); ++channelId )
 			{
-				timeCodes.insert( UsdTimeCode( static_cast< double >( frame ) ) );
-				FbxTime currentFrame;
-				currentFrame.SetFrame( frame );
-				channelValues[ index ][ channelId ] = animCurve->Evaluate( currentFrame );
-				++index;
+				// We are assuming a singular FbxAnimCurve per property, it is however
+				// possible to have multiple FbxAnimCurves connected to a singular property
+				// If this is deemed necessary, add support for it, otherwise it can be
+				// ignored for now see curveNode->GetCurveCount()
+				if( const auto animCurve = curveNode->GetCurve( channelId ) )
+				{
+					channelValues[ channelId ] = animCurve->Evaluate( time );
+				}
 			}
-		}
-		FbxToUsd propertyConverter{ &fbxProperty };
+			return FbxToUsd{ &fbxProperty }.getValue( channelValues );
+		};
+	}
 
-		std::transform(
-			channelValues.begin(),
-			channelValues.end(),
-			timeCodes.begin(),
-			std::back_inserter( result ),
-			[ & ]( const auto& channelValue, const auto& timeCode ) -> std::tuple< UsdTimeCode, VtValue >
-			{
-				VtValue val = propertyConverter.getValue( channelValue );
-				return { timeCode, val };
-			} );
+	/// Returns true when \p node uses any of the rotation/scaling offsets and pivots or the pre/post rotations
+	bool hasPivots( FbxNode* node, const remedy::FbxAnimatedChannelIndex& animatedChannels )
+	{
+		auto isUsed = [ & ]( FbxPropertyT< FbxDouble3 >& property )
+		{
+			const FbxDouble3 value = property.Get();
+			return value[ 0 ] != 0.0 || value[ 1 ] != 0.0 || value[ 2 ] != 0.0 || animatedChannels.IsAnimated( property );
+		};
 
-		return result;
+		// Pre and post rotations are ignored by FBX unless RotationActive is set
+		return isUsed( node->RotationOffset ) || isUsed( node->RotationPivot ) || isUsed( node->ScalingOffset )
+			   || isUsed( node->ScalingPivot )
+			   || ( node->RotationActive.Get() && ( isUsed( node->PreRotation ) || isUsed( node->PostRotation ) ) );
 	}
 
-	std::vector< FbxProperty > getUserProperties( const FbxNode* fbxNode )
+	/// Returns true when the local transform of \p joint changes over the take, or when it holds still somewhere other
+	/// than its rest transform. \p time is any time within the take.
+	bool isJointAnimated( FbxNode* joint, const remedy::FbxAnimatedChannelIndex& animatedChannels, FbxTime time )
 	{
-		std::vector< FbxProperty > result;
-		for( FbxProperty fbxProperty = fbxNode->GetFirstProperty(); fbxProperty.IsValid();
-			 fbxProperty = fbxNode->GetNextProperty( fbxProperty ) )
-		{
-			if( !fbxProperty.GetFlag( FbxPropertyFlags::EFlags::eUserDefined ) )
+		const std::array< const FbxProperty*, 9 > transformProperties{ &joint->LclTranslation,
+																	   &joint->LclRotation,
+																	   &joint->LclScaling,
+																	   &joint->RotationOffset,
+																	   &joint->RotationPivot,
+																	   &joint->ScalingOffset,
+																	   &joint->ScalingPivot,
+																	   &joint->PreRotation,
+																	   &joint->PostRotation };
+		bool hasCurves = false;
+		for( const FbxProperty* property : transformProperties )
+		{
+			if( !animatedChannels.IsAnimated( *property ) )
 			{
 				continue;
 			}
-			result.push_back( fbxProperty );
+			if( !animatedChannels.IsConstant( *property ) )
+			{
+				return true;
+			}
+			hasCurves = true;
 		}
-		return result;
+		if( !hasCurves )
+		{
+			return false;
+		}
+
+		// Constant curves hold the joint still, but not necessarily where the rest transform has it
+		FbxAnimEvaluator* evaluator = joint->GetAnimationEvaluator();
+		return !GfIsClose(
+			toGfMatrix( evaluator->GetNodeLocalTransform( joint, time ) ),
+			toGfMatrix( evaluator->GetNodeLocalTransform( joint ) ),
+			1e-6 );
 	}
 
-	std::vector< FbxProperty > getAnimatedUserProperties( const FbxNode* fbxNode, FbxAnimLayer* animLayer )
+	struct FoldedTransform
 	{
-		auto res = getUserProperties( fbxNode );
-		res.erase(
-			std::remove_if(
-				res.begin(),
-				res.end(),
-				[ & ]( FbxProperty& prop ) { return prop.GetCurveNode( animLayer ) == nullptr; } ),
-			res.end() );
-		return res;
+		GfVec3d translation;
+		GfVec3f rotation;
+	};
+
+	/// Folds the offsets, pivots and pre/post rotations of \p node into a plain translation and rotation, the
+	/// scale is left untouched. Evaluated at \p time, or from the static property values without one.
+	FoldedTransform foldPivots( FbxNode* node, const std::optional< FbxTime >& time )
+	{
+		auto get = [ & ]( FbxPropertyT< FbxDouble3 >& property ) -> FbxVector4
+		{
+			const FbxDouble3 value = time ? property.EvaluateValue( *time ) : property.Get();
+			return { value[ 0 ], value[ 1 ], value[ 2 ], 0.0 };
+		};
+
+		const FbxEuler::EOrder rotationOrder = node->RotationOrder.Get();
+		FbxAMatrix rotation;
+		FbxRotationOrder( rotationOrder ).V2M( rotation, get( node->LclRotation ) );
+		// FBX evaluates T * Roff * Rp * Rpre * R * Rpost^-1 * Rp^-1 * Soff * Sp * S * Sp^-1, pre and post
+		// rotations always use the XYZ order
+		if( node->RotationActive.Get() )
+		{
+			FbxAMatrix preRotation;
+			FbxAMatrix postRotation;
+			FbxRotationOrder( FbxEuler::eOrderXYZ ).V2M( preRotation, get( node->PreRotation ) );
+			FbxRotationOrder( FbxEuler::eOrderXYZ ).V2M( postRotation, get( node->PostRotation ) );
+			rotation = preRotation * rotation * postRotation.Inverse();
+		}
+
+		FbxAMatrix scaling;
+		scaling.SetS( get( node->LclScaling ) );
+		const FbxVector4 rotationPivot = get( node->RotationPivot );
+		const FbxVector4 scalingPivot = get( node->ScalingPivot );
+		const FbxVector4 translation
+			= get( node->LclTranslation ) + get( node->RotationOffset ) + rotationPivot
+			  + rotation.MultT( get( node->ScalingOffset ) + scalingPivot - scaling.MultT( scalingPivot ) - rotationPivot );
+
+		FbxVector4 euler;
+		FbxRotationOrder( rotationOrder ).M2V( euler, rotation );
+		return { GfVec3d( translation[ 0 ], translation[ 1 ], translation[ 2 ] ),
+				 GfVec3f(
+					 static_cast< float >( euler[ 0 ] ),
+					 static_cast< float >( euler[ 1 ] ),
+					 static_cast< float >( euler[ 2 ] ) ) };
 	}
 
 	double toOneTenthOfScene( double value, FbxSystemUnit systemUnits )
@@ -493,36 +583,208 @@ namespace converters
 		return { static_cast< float >( S[ 0 ] ), static_cast< float >( S[ 1 ] ), static_cast< float >( S[ 2 ] ) };
 	}
 
-	GfVec3f rotationPivot( const FbxNode* node )
+	/// Unit conversion scales the nodes right below the root node, everything else inherits it from them
+	bool isRootLevel( const FbxNode* node )
 	{
-		const auto R = node->RotationPivot.Get();
-		return { static_cast< float >( R[ 0 ] ), static_cast< float >( R[ 1 ] ), static_cast< float >( R[ 2 ] ) };
+		return node->GetParent() != nullptr && node->GetParent()->GetParent() == nullptr;
 	}
 
-	VtVec3fArray meshPoints( const FbxNode* node )
+	bool convertsTransform( const remedy::FbxSceneConversion& conversion, const FbxNode* node )
 	{
-		VtVec3fArray points;
-		// static_cast is used here because at this point we are certain that the node
-		// can be cast as an FbxMesh
-		const auto pMesh = static_cast< const FbxMesh* >( node->GetNodeAttribute() );
-		FbxStatus status;
-		FbxVector4* controlPoints = pMesh->GetControlPoints( &status );
+		return conversion.ConvertsAxis() || ( conversion.ConvertsUnits() && isRootLevel( node ) );
+	}
+
+	GfMatrix4d localTransform( const remedy::FbxSceneConversion& conversion, const FbxNode* node, const FbxAMatrix& matrix )
+	{
+		const GfMatrix4d transform = conversion.inverseAxis * helpers::toGfMatrix( matrix ) * conversion.axis;
+		return isRootLevel( node ) ? transform * GfMatrix4d().SetScale( conversion.scaleFactor ) : transform;
+	}
+
+	GfMatrix4d globalTransform( const remedy::FbxSceneConversion& conversion, const FbxAMatrix& matrix )
+	{
+		return conversion.inverseAxis * helpers::toGfMatrix( matrix ) * conversion.axis
+			   * GfMatrix4d().SetScale( conversion.scaleFactor );
+	}
+
+	GfVec3d translation( const remedy::FbxSceneConversion& conversion, const FbxNode* node, const GfVec3d& value )
+	{
+		const GfVec3d converted = conversion.axis.TransformDir( value );
+		return isRootLevel( node ) ? converted * conversion.scaleFactor : converted;
+	}
+
+	GfVec3f rotation( const remedy::FbxSceneConversion& conversion, const FbxNode* node, const GfVec3f& value )
+	{
+		if( !conversion.ConvertsAxis() )
+		{
+			return value;
+		}
+
+		// Euler angles do not convert axis by axis, the rotation is converted as a matrix in the order of the node
+		FbxRotationOrder rotationOrder( node->RotationOrder.Get() );
+		FbxAMatrix matrix;
+		rotationOrder.V2M( matrix, FbxVector4( value[ 0 ], value[ 1 ], value[ 2 ] ) );
+		FbxVector4 euler;
+		rotationOrder.M2V(
+			euler,
+			helpers::toFbxAMatrix( conversion.inverseAxis * helpers::toGfMatrix( matrix ) * conversion.axis ) );
+		return { static_cast< float >( euler[ 0 ] ), static_cast< float >( euler[ 1 ] ), static_cast< float >( euler[ 2 ] ) };
+	}
 
+	GfVec3f scale( const remedy::FbxSceneConversion& conversion, const FbxNode* node, const GfVec3f& value )
+	{
+		// The axis conversion only swaps and flips axes, which leaves the scale of every axis as it is
+		GfVec3f converted( 0.0f );
+		for( int from = 0; from < 3; ++from )
+		{
+			for( int to = 0; to < 3; ++to )
+			{
+				const double weight = conversion.axis[ from ][ to ] * conversion.axis[ from ][ to ];
+				converted[ to ] += static_cast< float >( weight ) * value[ from ];
+			}
+		}
+		return isRootLevel( node ) ? converted * static_cast< float >( conversion.scaleFactor ) : converted;
+	}
+
+	/// Change of basis from \p axisSystem into Y-up, with the right, up and front vectors of \p axisSystem as columns
+	GfMatrix4d axisConversion( const FbxAxisSystem& axisSystem )
+	{
+		int upSign = 1;
+		int frontSign = 1;
+		const FbxAxisSystem::EUpVector upAxis = axisSystem.GetUpVector( upSign );
+		const FbxAxisSystem::EFrontVector frontParity = axisSystem.GetFrontVector( frontSign );
+
+		// The front vector is the first (even) or second (odd) of the two axes that are not up
+		GfVec3d up( 0.0 );
+		up[ upAxis - FbxAxisSystem::eXAxis ] = upSign;
+		GfVec3d front( 0.0 );
+		if( frontParity == FbxAxisSystem::eParityEven )
+		{
+			front[ upAxis == FbxAxisSystem::eXAxis ? 1 : 0 ] = frontSign;
+		}
+		else
+		{
+			front[ upAxis == FbxAxisSystem::eZAxis ? 1 : 2 ] = frontSign;
+		}
+		const GfVec3d right
+			= axisSystem.GetCoorSystem() == FbxAxisSystem::eRightHanded ? GfCross( up, front ) : GfCross( front, up );
+
+		GfMatrix4d axis( 1.0 );
+		for( int row = 0; row < 3; ++row )
+		{
+			axis[ row ][ 0 ] = right[ row ];
+			axis[ row ][ 1 ] = up[ row ];
+			axis[ row ][ 2 ] = front[ row ];
+		}
+		return axis;
+	}
+
+	FbxMatrix geometryToNodeTransform( const FbxNode* node )
+	{
 		FbxVector4 T = node->GetGeometricTranslation( FbxNode::eSourcePivot );
 		FbxVector4 R = node->GetGeometricRotation( FbxNode::eSourcePivot );
 		FbxVector4 S = node->GetGeometricScaling( FbxNode::eSourcePivot );
 
 		FbxMatrix geometryToNode;
 		geometryToNode.SetTRS( T, R, S );
+		return geometryToNode;
+	}
+
+	VtVec3fArray meshPoints( const remedy::FbxSceneConversion& conversion, const FbxNode* node )
+	{
+		VtVec3fArray points;
+		// static_cast is used here because at this point we are certain that the node
+		// can be cast as an FbxMesh
+		const auto pMesh = static_cast< const FbxMesh* >( node->GetNodeAttribute() );
+		FbxStatus status;
+		FbxVector4* controlPoints = pMesh->GetControlPoints( &status );
+		const FbxMatrix geometryToNode = geometryToNodeTransform( node );
 
 		std::transform(
 			controlPoints,
 			controlPoints + pMesh->GetControlPointsCount(),
 			std::back_inserter( points ),
-			[ & ]( const FbxVector4& v ) { return helpers::toGfVec( geometryToNode.MultNormalize( v ) ); } );
+			[ & ]( const FbxVector4& v )
+			{ return conversion.axis.TransformDir( helpers::toGfVec( geometryToNode.MultNormalize( v ) ) ); } );
 		return points;
 	}
 
+	// Control points that move less than this are left out of blend shapes
+	constexpr float BLEND_SHAPE_OFFSET_EPSILON = 1e-5f;
+
+	/// The target shapes of a blend shape channel as offsets from the rest points of the mesh, in-between targets
+	/// first and the full target last like FBX orders them
+	struct BlendShapeTargets
+	{
+		/// Control points moved by at least one of the targets, all targets share them
+		VtIntArray pointIndices;
+		/// One entry per target, one offset per point index
+		std::vector< VtVec3fArray > offsets;
+		std::vector< std::string > names;
+		/// Deform percent at which each target is reached
+		std::vector< double > fullWeights;
+	};
+
+	BlendShapeTargets blendShapeTargets(
+		const remedy::FbxSceneConversion& conversion,
+		const FbxNode* node,
+		const VtVec3fArray& restPoints,
+		FbxBlendShapeChannel* channel )
+	{
+		TRACE_FUNCTION()
+
+		BlendShapeTargets targets;
+		const FbxMatrix geometryToNode = geometryToNodeTransform( node );
+		const int numTargets = channel->GetTargetShapeCount();
+		const double* fullWeights = channel->GetTargetShapeFullWeights();
+
+		std::vector< const FbxVector4* > targetPoints;
+		std::vector< size_t > numTargetPoints;
+		for( int targetId = 0; targetId < numTargets; ++targetId )
+		{
+			FbxShape* shape = channel->GetTargetShape( targetId );
+			targetPoints.push_back( shape->GetControlPoints() );
+			numTargetPoints.push_back(
+				std::min( static_cast< size_t >( shape->GetControlPointsCount() ), restPoints.size() ) );
+			targets.names.push_back( shape->GetName() );
+			targets.fullWeights.push_back( fullWeights != nullptr ? fullWeights[ targetId ] : 100.0 );
+		}
+
+		auto offsetAt = [ & ]( size_t targetId, size_t point )
+		{
+			const GfVec3f targetPoint = helpers::toGfVec( geometryToNode.MultNormalize( targetPoints[ targetId ][ point ] ) );
+			return conversion.axis.TransformDir( targetPoint ) - restPoints[ point ];
+		};
+
+		// Shapes store every control point of the mesh, most of them untouched. Only the ones that move are kept
+		for( size_t point = 0; point < restPoints.size(); ++point )
+		{
+			for( size_t targetId = 0; targetId < targetPoints.size(); ++targetId )
+			{
+				if( point < numTargetPoints[ targetId ]
+					&& offsetAt( targetId, point ).GetLengthSq() > BLEND_SHAPE_OFFSET_EPSILON * BLEND_SHAPE_OFFSET_EPSILON )
+				{
+					targets.pointIndices.push_back( static_cast< int >( point ) );
+					break;
+				}
+			}
+		}
+
+		for( size_t targetId = 0; targetId < targetPoints.size(); ++targetId )
+		{
+			VtVec3fArray offsets( targets.pointIndices.size() );
+			for( size_t i = 0; i < targets.pointIndices.size(); ++i )
+			{
+				const auto point = static_cast< size_t >( targets.pointIndices[ i ] );
+				if( point < numTargetPoints[ targetId ] )
+				{
+					offsets[ i ] = offsetAt( targetId, point );
+				}
+			}
+			targets.offsets.push_back( std::move( offsets ) );
+		}
+		return targets;
+	}
+
 	TfToken imageableVisibility( FbxNode* node, FbxTime time )
 	{
 		const double visibility = node->GetAnimationEvaluator()->GetPropertyValue< FbxDouble >( node->Visibility, time );
@@ -539,7 +801,7 @@ namespace converters
 		return UsdGeomTokens->inherited;
 	}
 
-	VtVec3fArray meshNormals( const FbxNode* node )
+	VtVec3fArray meshNormals( const remedy::FbxSceneConversion& conversion, const FbxNode* node )
 	{
 		VtVec3fArray normals;
 		// static_cast is used here because at this point we are certain that the node
@@ -570,7 +832,7 @@ namespace converters
 				if( perPolygonVertexNormals )
 				{
 					FbxVector4 normal = helpers::getAtVertexIndex( perPolygonVertexNormals, currentIndex );
-					normals.push_back( helpers::toGfVec( normal ) );
+					normals.push_back( conversion.axis.TransformDir( helpers::toGfVec( normal ) ) );
 					++currentIndex;
 				}
 				else
@@ -578,7 +840,7 @@ namespace converters
 					FbxVector4 normal;
 					if( pMesh->GetPolygonVertexNormal( polygonIndex, polygonVertex, normal ) )
 					{
-						normals.push_back( helpers::toGfVec( normal ) );
+						normals.push_back( conversion.axis.TransformDir( helpers::toGfVec( normal ) ) );
 					}
 				}
 			}
@@ -587,7 +849,7 @@ namespace converters
 		return normals;
 	}
 
-	VtVec3fArray meshTangents( const FbxNode* node )
+	VtVec3fArray meshTangents( const remedy::FbxSceneConversion& conversion, const FbxNode* node )
 	{
 		VtVec3fArray tangents;
 		// static_cast is used here because at this point we are certain that the node
@@ -621,7 +883,7 @@ namespace converters
 			for( int polygonVertex = 0; polygonVertex != pMesh->GetPolygonSize( polygonIndex ); ++polygonVertex )
 			{
 				FbxVector4 normal = helpers::getAtVertexIndex( perPolygonVertexTangents, currentIndex );
-				tangents.push_back( helpers::toGfVec( normal ) );
+				tangents.push_back( conversion.axis.TransformDir( helpers::toGfVec( normal ) ) );
 				++currentIndex;
 			}
 		}
@@ -711,18 +973,19 @@ namespace converters
 		return texCoords;
 	}
 
+	// Apertures and focal lengths are in tenths of the scene unit, the converted scene is always in centimeters
 	double cameraApertureHeight( const FbxCamera* camera )
 	{
 		return helpers::toOneTenthOfScene(
 			camera->FilmHeight * camera->FilmSqueezeRatio * helpers::MM_PER_INCH,
-			camera->GetScene()->GetGlobalSettings().GetSystemUnit() );
+			FbxSystemUnit::cm );
 	}
 
 	double cameraApertureWidth( const FbxCamera* camera )
 	{
 		return helpers::toOneTenthOfScene(
 			camera->FilmWidth * camera->FilmSqueezeRatio * helpers::MM_PER_INCH,
-			camera->GetScene()->GetGlobalSettings().GetSystemUnit() );
+			FbxSystemUnit::cm );
 	}
 
 	TfToken cameraProjectionMode( const FbxCamera* camera )
@@ -737,9 +1000,10 @@ namespace converters
 		return UsdGeomTokens->perspective;
 	}
 
-	GfVec2f cameraClippingRange( const FbxCamera* camera )
+	GfVec2f cameraClippingRange( const remedy::FbxSceneConversion& conversion, const FbxCamera* camera )
 	{
-		return { static_cast< float >( camera->NearPlane ), static_cast< float >( camera->FarPlane ) };
+		return { static_cast< float >( camera->NearPlane * conversion.scaleFactor ),
+				 static_cast< float >( camera->FarPlane * conversion.scaleFactor ) };
 	}
 
 	double cameraFocalLength( FbxCamera* camera, FbxTime t = FbxTime(), bool scale = false )
@@ -747,8 +1011,7 @@ namespace converters
 		const double focalLength
 			= camera->GetNode()->GetAnimationEvaluator()->GetPropertyValue< FbxDouble >( camera->FocalLength, t );
 
-		return scale ? helpers::toOneTenthOfScene( focalLength, camera->GetScene()->GetGlobalSettings().GetSystemUnit() )
-					 : focalLength;
+		return scale ? helpers::toOneTenthOfScene( focalLength, FbxSystemUnit::cm ) : focalLength;
 	}
 
 	float cameraFieldOfView( FbxCamera* camera, FbxTime t = FbxTime() )
@@ -757,83 +1020,54 @@ namespace converters
 			camera->GetNode()->GetAnimationEvaluator()->GetPropertyValue< FbxDouble >( camera->FieldOfView, t ) );
 	}
 
-	TfToken skeletonToTokenPath( const FbxSkeleton* skeleton, TfToken rootJointName )
+	enum class Space
 	{
-		// Note: If perf is an issue with this, resort to some kind of caching mechanism.
-		TfToken jointName( skeleton->GetNode()->GetName() );
-		if( jointName == rootJointName )
-		{
-			return jointName;
-		}
-
-		FbxNode* parent = skeleton->GetNode()->GetParent();
-		if( parent == nullptr )
-		{
-			return jointName;
-		}
-
-		SdfPath jointPath = SdfPath( remedy::cleanName( parent->GetName() ) )
-								.AppendChild( TfToken( remedy::cleanName( jointName.GetString() ) ) );
-		while( parent->GetName() != rootJointName )
-		{
-			parent = parent->GetParent();
-			if( parent == nullptr )
-			{
-				break;
-			}
-			jointPath = SdfPath( remedy::cleanName( parent->GetName() ) ).AppendPath( jointPath );
-		}
-		return jointPath.GetAsToken();
-	}
+		Local,
+		World
+	};
 
-	// Skeleton hierarchies in UsdSkel are expressed as an array of TfTokeens in a
-	// order dependent `joints` property Each entry in this `joints` attribute must
-	// have the full path the root joint This function essentially builds those full
-	// paths from a list of FbxSkeletons
-	VtTokenArray skeletonHierarchyToTokenList( const std::vector< const FbxSkeleton* >& skeletonHierarchy )
+	/// Scale of the joint translations, from the originally authored units into the centimeters of the converted scene
+	double jointScaleFactor( const FbxScene* scene )
 	{
-		const TfToken rootJointName( skeletonHierarchy[ 0 ]->GetNode()->GetName() );
-		VtTokenArray jointHierarchyAttribute;
-		std::transform(
-			skeletonHierarchy.cbegin(),
-			skeletonHierarchy.cend(),
-			std::back_inserter( jointHierarchyAttribute ),
-			[ & ]( const FbxSkeleton* skeleton ) -> TfToken { return skeletonToTokenPath( skeleton, rootJointName ); } );
-		return jointHierarchyAttribute;
+		return FbxSystemUnit::cm.GetConversionFactorFrom( scene->GetGlobalSettings().GetOriginalSystemUnit() );
 	}
 
-	enum class Space
+	/// \p transform is already converted into the axis system and units of the scene
+	GfMatrix4d jointToMatrix( const GfMatrix4d& transform, double scaleFactor )
 	{
-		Local,
-		World
-	};
+		FbxAMatrix matrix = helpers::toFbxAMatrix( transform );
+		// We have to force the scale component of the resulting matrix to
+		// be 1.0 If there's any LclScaling present on a limbnode, that gets
+		// applied to the rotation, but not the translation for some ungodly
+		// reason
+		matrix.SetS( { 1.0, 1.0, 1.0 } );
+		// Due to the above, we also scale the translation from the originally
+		// authored coords into the exported file unit scale so it matches what
+		// we output in USD as metersPerUnit
+		matrix.SetTOnly( matrix.GetT() * scaleFactor );
+		return helpers::toGfMatrix( matrix );
+	}
 
-	VtMatrix4dArray skeletonHierarchyToMatrices(
-		const std::vector< const FbxSkeleton* >& skeletonHierarchy,
+	VtMatrix4dArray skeletonToMatrices(
+		const remedy::FbxSceneConversion& conversion,
+		const remedy::FbxSkeletonTable::Skeleton& skeleton,
 		double scaleFactor,
 		Space space )
 	{
 		VtMatrix4dArray output;
-		const auto animEvaluator = skeletonHierarchy[ 0 ]->GetScene()->GetAnimationEvaluator();
-		output.reserve( skeletonHierarchy.size() );
+		const auto animEvaluator = skeleton.joints[ 0 ].node->GetScene()->GetAnimationEvaluator();
+		output.reserve( skeleton.joints.size() );
 		std::transform(
-			skeletonHierarchy.cbegin(),
-			skeletonHierarchy.cend(),
+			skeleton.joints.cbegin(),
+			skeleton.joints.cend(),
 			std::back_inserter( output ),
-			[ & ]( const FbxSkeleton* skeleton ) -> GfMatrix4d
-			{
-				auto matrix = space == Space::Local ? animEvaluator->GetNodeLocalTransform( skeleton->GetNode() )
-													: animEvaluator->GetNodeGlobalTransform( skeleton->GetNode() );
-				// We have to force the scale component of the resulting matrix to
-				// be 1.0 If there's any LclScaling present on a limbnode, that gets
-				// applied to the rotation, but not the translation for some ungodly
-				// reason
-				matrix.SetS( { 1.0, 1.0, 1.0 } );
-				// Due to the above, we also scale the translation from the originally
-				// authored coords into the exported file unit scale so it matches what
-				// we output in USD as metersPerUnit
-				matrix.SetTOnly( matrix.GetT() * scaleFactor );
-				return helpers::toGfMatrix( matrix );
+			[ & ]( const remedy::FbxSkeletonTable::Joint& joint ) -> GfMatrix4d
+			{
+				return jointToMatrix(
+					space == Space::Local
+						? localTransform( conversion, joint.node, animEvaluator->GetNodeLocalTransform( joint.node ) )
+						: globalTransform( conversion, animEvaluator->GetNodeGlobalTransform( joint.node ) ),
+					scaleFactor );
 			} );
 		return output;
 	}
@@ -841,39 +1075,36 @@ namespace converters
 	struct BindingData
 	{
 		VtTokenArray names;
+		std::vector< const FbxCluster* > clusters;
 		VtIntArray perVertexInfluences;
 		VtFloatArray perVertexWeights;
 		int influencesPerVertex;
 		SdfPath pathToSkeleton;
 	};
 
-	BindingData getBindingData( const FbxSkin* skin, const FbxMesh* mesh )
+	BindingData getBindingData(
+		const FbxSkin* skin,
+		const FbxMesh* mesh,
+		remedy::FbxSkeletonTable& skeletons,
+		const remedy::UsdFbxDataReader::Options& options )
 	{
+		TRACE_FUNCTION()
+
 		if( skin->GetClusterCount() == 0 )
 		{
-			return { VtTokenArray(), VtIntArray(), VtFloatArray(), 0, SdfPath::EmptyPath() };
+			return { VtTokenArray(), {}, VtIntArray(), VtFloatArray(), 0, SdfPath::EmptyPath() };
 		}
 
+		const size_t numControlPoints = static_cast< size_t >( mesh->GetControlPointsCount() );
 		VtTokenArray jointsUsed;
-		size_t elementSize = 0;
+		SdfPath pathToSkeleton;
 		jointsUsed.reserve( skin->GetClusterCount() );
-		std::vector< std::vector< std::tuple< int, double > > > perVertexIndicesAndWeights(
-			mesh->GetControlPointsCount(),
-			std::vector< std::tuple< int, double > >() );
-
-		auto* rootBone = skin->GetCluster( 0 )->GetLink();
-		while( rootBone )
-		{
-			auto* newParent = rootBone->GetParent();
-			if( !newParent->GetNodeAttribute()
-				|| newParent->GetNodeAttribute()->GetAttributeType() != FbxNodeAttribute::eSkeleton )
-			{
-				break;
-			}
-			rootBone = newParent;
-		}
-		const TfToken rootBoneName( rootBone->GetName() );
 
+		// Influences are gathered in compressed rows, one row per control point. The first pass counts the influences
+		// of every control point, the second one writes them straight into a pair of flat buffers
+		std::vector< const FbxCluster* > clusters;
+		clusters.reserve( skin->GetClusterCount() );
+		std::vector< size_t > rowOffsets( numControlPoints + 1, 0 );
 		for( int clusterId = 0; clusterId < skin->GetClusterCount(); clusterId++ )
 		{
 			const FbxCluster* cluster = skin->GetCluster( clusterId );
@@ -883,59 +1114,127 @@ namespace converters
 				continue;
 			}
 
+			const remedy::FbxSkeletonTable::Skeleton& skeleton = skeletons.GetSkeleton( link );
+			const int jointIndex = skeletons.GetJointIndex( link );
+			if( jointIndex < 0 )
+			{
+				TF_WARN( "\"%s\" is not part of a skeleton, its influences will be ignored", link->GetName() );
+				continue;
+			}
+			if( pathToSkeleton.IsEmpty() )
+			{
+				pathToSkeleton = skeleton.primPath;
+			}
+
 			const int* controlPointIndices = cluster->GetControlPointIndices();
-			const double* controlPointWeights = cluster->GetControlPointWeights();
 			for( int controlPointId = 0; controlPointId < cluster->GetControlPointIndicesCount(); ++controlPointId )
 			{
-				const size_t influenceIndex = jointsUsed.size();
-
-				perVertexIndicesAndWeights[ controlPointIndices[ controlPointId ] ].push_back(
-					{ influenceIndex, controlPointWeights[ controlPointId ] } );
-				const size_t numInfluences = perVertexIndicesAndWeights[ controlPointIndices[ controlPointId ] ].size();
-				elementSize = std::max( numInfluences, elementSize );
+				++rowOffsets[ controlPointIndices[ controlPointId ] + 1 ];
 			}
 
-			TfToken skeletonPath(
-				skeletonToTokenPath( static_cast< const FbxSkeleton* >( link->GetNodeAttribute() ), rootBoneName ) );
-			jointsUsed.push_back( skeletonPath );
+			clusters.push_back( cluster );
+			jointsUsed.push_back( skeleton.joints[ jointIndex ].path );
+		}
+
+		size_t maxRowSize = 0;
+		for( size_t controlPoint = 0; controlPoint < numControlPoints; ++controlPoint )
+		{
+			maxRowSize = std::max( rowOffsets[ controlPoint + 1 ], maxRowSize );
+			rowOffsets[ controlPoint + 1 ] += rowOffsets[ controlPoint ];
 		}
 
-		// split the aggregated per-vertex vector into two individual vectors for
-		// indices and weights. all entries must be of the same element size, add
-		// missing empty weight values where necessary.
-		VtIntArray jointIndices;
-		jointIndices.reserve( mesh->GetControlPointsCount() * elementSize );
-		VtFloatArray jointWeights;
-		jointWeights.reserve( mesh->GetControlPointsCount() * elementSize );
-		const auto missingValue = std::make_tuple< int, double >( 0, 0.0 );
-		for( const auto& vertexInfluencesAndWeights : perVertexIndicesAndWeights )
+		std::vector< int > rowInfluences( rowOffsets.back() );
+		std::vector< float > rowWeights( rowOffsets.back() );
+		std::vector< size_t > rowEnds( rowOffsets.cbegin(), rowOffsets.cend() - 1 );
+		for( size_t influenceIndex = 0; influenceIndex < clusters.size(); ++influenceIndex )
 		{
-			const size_t lastIndex = elementSize - ( elementSize - vertexInfluencesAndWeights.size() );
-			for( size_t i = 0; i < elementSize; ++i )
+			const FbxCluster* cluster = clusters[ influenceIndex ];
+			const int* controlPointIndices = cluster->GetControlPointIndices();
+			const double* controlPointWeights = cluster->GetControlPointWeights();
+			for( int controlPointId = 0; controlPointId < cluster->GetControlPointIndicesCount(); ++controlPointId )
 			{
-				auto [ influenceIndex, weight ] = i < lastIndex ? vertexInfluencesAndWeights[ i ] : missingValue;
-				jointIndices.push_back( influenceIndex );
-				jointWeights.push_back( static_cast< float >( weight ) );
+				const size_t entry = rowEnds[ controlPointIndices[ controlPointId ] ]++;
+				rowInfluences[ entry ] = static_cast< int >( influenceIndex );
+				rowWeights[ entry ] = static_cast< float >( controlPointWeights[ controlPointId ] );
 			}
 		}
 
-		const int influencesPerComponents = static_cast< int >( elementSize );
-
-		UsdSkelNormalizeWeights( jointWeights, influencesPerComponents );
-		UsdSkelSortInfluences( jointIndices, jointWeights, influencesPerComponents );
+		// Pruning keeps the largest influences of every row, the rows are sorted and cut short in place. The largest
+		// influence always survives minWeight, no control point loses its skinning altogether
+		std::vector< size_t > rowSizes( numControlPoints );
+		const bool pruneInfluences = options.maxInfluences > 0 || options.minWeight > 0.0f;
+		WorkParallelForN(
+			numControlPoints,
+			[ & ]( size_t begin, size_t end )
+			{
+				for( size_t controlPoint = begin; controlPoint < end; ++controlPoint )
+				{
+					const size_t rowBegin = rowOffsets[ controlPoint ];
+					size_t rowSize = rowOffsets[ controlPoint + 1 ] - rowBegin;
+					if( pruneInfluences )
+					{
+						float* weights = rowWeights.data() + rowBegin;
+						helpers::sortInfluencesByWeight( rowInfluences.data() + rowBegin, weights, rowSize );
+
+						// minWeight applies to normalized weights
+						const float minWeight = options.minWeight * std::accumulate( weights, weights + rowSize, 0.0f );
+						while( rowSize > 1 && weights[ rowSize - 1 ] < minWeight )
+						{
+							--rowSize;
+						}
+						if( options.maxInfluences > 0 )
+						{
+							rowSize = std::min( rowSize, options.maxInfluences );
+						}
+					}
+					rowSizes[ controlPoint ] = rowSize;
+				}
+			} );
 
-		SdfPath pathToSkeleton( "/ROOT" );
+		const size_t elementSize = rowSizes.empty() ? 0 : *std::max_element( rowSizes.cbegin(), rowSizes.cend() );
+		if( pruneInfluences )
 		{
-			const FbxNode* parent = rootBone->GetParent();
-			SdfPath jointPath = SdfPath( TfToken( rootBone->GetName() ) );
-			while( parent && parent != parent->GetScene()->GetRootNode() )
-			{
-				jointPath = SdfPath( parent->GetName() ).AppendPath( jointPath );
-				parent = parent->GetParent();
-			}
-			pathToSkeleton = pathToSkeleton.AppendPath( jointPath );
+			TF_DEBUG( USDFBX )
+				.Msg(
+					"UsdFbx - Pruned the skin of \"%s\" from %zu to %zu influences per control point\n",
+					mesh->GetNode()->GetName(),
+					maxRowSize,
+					elementSize );
+		}
+
+		// UsdSkel wants the same number of influences for every control point, the arrays start out zeroed so short
+		// rows are padded by copying them over. Copying, normalizing and sorting only touch the influences of a single
+		// control point, so they run over chunks of control points in parallel
+		const int influencesPerComponents = static_cast< int >( elementSize );
+		VtIntArray jointIndices( numControlPoints * elementSize );
+		VtFloatArray jointWeights( numControlPoints * elementSize );
+		if( elementSize > 0 )
+		{
+			int* indicesData = jointIndices.data();
+			float* weightsData = jointWeights.data();
+			WorkParallelForN(
+				numControlPoints,
+				[ & ]( size_t begin, size_t end )
+				{
+					for( size_t controlPoint = begin; controlPoint < end; ++controlPoint )
+					{
+						const size_t rowBegin = rowOffsets[ controlPoint ];
+						const size_t rowSize = rowSizes[ controlPoint ];
+						const size_t padded = controlPoint * elementSize;
+						std::copy_n( rowInfluences.cbegin() + rowBegin, rowSize, indicesData + padded );
+						std::copy_n( rowWeights.cbegin() + rowBegin, rowSize, weightsData + padded );
+					}
+
+					const size_t chunkBegin = begin * elementSize;
+					const size_t chunkSize = ( end - begin ) * elementSize;
+					TfSpan< int > indices( indicesData + chunkBegin, chunkSize );
+					TfSpan< float > weights( weightsData + chunkBegin, chunkSize );
+					UsdSkelNormalizeWeights( weights, influencesPerComponents );
+					UsdSkelSortInfluences( indices, weights, influencesPerComponents );
+				} );
 		}
-		return { jointsUsed, jointIndices, jointWeights, influencesPerComponents, pathToSkeleton };
+
+		return { jointsUsed, clusters, jointIndices, jointWeights, influencesPerComponents, pathToSkeleton };
 	}
 } // namespace converters
 
@@ -964,6 +1263,7 @@ namespace
 			SdfValueTypeNames->Token,
 			VtValue( converters::imageableVisibility( context.GetNode(), FbxTime() ) ),
 			[]( FbxNode* node, FbxTime time ) { return VtValue( converters::imageableVisibility( node, time ) ); },
+			{ &context.GetNode()->Visibility },
 			{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->imageable ) } );
 
 		context.CreateUniformProperty(
@@ -985,8 +1285,9 @@ namespace
 	{
 		TF_DEBUG( USDFBX_FBX_READERS )
 			.Msg( "UsdFbx::FbxReaders - readUserProperties for \"%s\"\n", context.GetNode()->GetName() );
-		for( FbxProperty fbxProperty : helpers::getUserProperties( context.GetNode() ) )
+		for( const auto& userProperty : context.GetPropertyIndex().GetUserProperties() )
 		{
+			FbxProperty fbxProperty = userProperty.property;
 			helpers::FbxToUsd propertyConverter{ &fbxProperty };
 			auto valueType = propertyConverter.getSdfTypeName();
 			auto defaultValue = propertyConverter.getValue();
@@ -1021,6 +1322,7 @@ namespace
 			SdfValueTypeNames->Float,
 			VtValue( static_cast< float >( converters::cameraFocalLength( camera, FbxTime(), true ) ) ),
 			[]( FbxNode* node, FbxTime t ) { return VtValue( converters::cameraFocalLength( node->GetCamera(), t, true ) ); },
+			{ &camera->FocalLength },
 			{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->camera ) } );
 
 		context.CreateProperty(
@@ -1063,7 +1365,7 @@ namespace
 		context.CreateProperty(
 			UsdGeomTokens->clippingRange,
 			SdfValueTypeNames->Float2,
-			VtValue( converters::cameraClippingRange( camera ) ),
+			VtValue( converters::cameraClippingRange( context.GetConversion(), camera ) ),
 			{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->camera ) } );
 
 		context.CreateProperty(
@@ -1071,6 +1373,7 @@ namespace
 			SdfValueTypeNames->Float,
 			VtValue( converters::cameraFieldOfView( camera ) ),
 			[]( FbxNode* node, FbxTime t ) { return VtValue( converters::cameraFieldOfView( node->GetCamera(), t ) ); },
+			{ &camera->FieldOfView },
 			{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->generated ),
 			  { SdfFieldKeys->Custom, VtValue( true ) } } );
 	}
@@ -1553,51 +1856,507 @@ namespace
 		return result;
 	}
 
-	void readMesh( remedy::FbxNodeReaderContext& context )
+	/// Returns the prim at \p path, adding it to the children of its parent when it does not exist yet
+	remedy::UsdFbxDataReader::Prim& getOrAddChildPrim( remedy::FbxNodeReaderContext& context, const SdfPath& path )
 	{
-		TF_DEBUG( USDFBX_FBX_READERS ).Msg( "UsdFbx::FbxReaders - readMesh for \"%s\"\n", context.GetNode()->GetName() );
+		if( const auto prim = context.GetPrimAtPath( path ) )
+		{
+			return *prim.value();
+		}
 
-		context.GetOrAddPrim().typeName = UsdFbxPrimTypeNames->Mesh;
-		TfTokenVector apiSchemas;
+		if( auto parentPrim = context.GetPrimAtPath( path.GetParentPath() ) )
+		{
+			parentPrim.value()->children.push_back( path.GetNameToken() );
+		}
+		else
+		{
+			TF_WARN( "Unable to find a parent for <%s>", path.GetText() );
+		}
+		return context.AddPrim( path );
+	}
 
-		const FbxNode* fbxNode = context.GetNode();
-		if( !fbxNode->GetNodeAttribute() || fbxNode->GetNodeAttributeCount() == 0
-			|| fbxNode->GetNodeAttribute()->GetAttributeType() != FbxNodeAttribute::eMesh )
+	/// Returns a free path for a new prototype of the prim at \p primPath, in the \p prototypesName scope under the
+	/// root. The scope is added on first use, the prototype itself is left to the caller.
+	SdfPath getPrototypePath( remedy::FbxNodeReaderContext& context, const TfToken& prototypesName, const SdfPath& primPath )
+	{
+		// Prototypes live in a class, stage traversals skip them
+		const SdfPath prototypesPath = context.GetRootPath().AppendChild( prototypesName );
+		if( !context.GetPrimAtPath( prototypesPath ) )
 		{
-			return;
+			remedy::UsdFbxDataReader::Prim& prototypesPrim = getOrAddChildPrim( context, prototypesPath );
+			prototypesPrim.specifier = SdfSpecifierClass;
+			prototypesPrim.typeName = UsdFbxPrimTypeNames->Scope;
 		}
 
-		auto textureCoordinates = getMeshTextureCoordinates( fbxNode );
-		for( const auto& [ fbxUvName, usdUvData ] : textureCoordinates )
+		// Flattening the path loses its separators, /ROOT/a_b/c and /ROOT/a/b_c end up with the same name
+		const std::string baseName
+			= TfStringReplace( primPath.MakeRelativePath( context.GetRootPath() ).GetString(), "/", "_" );
+		SdfPath prototypePath = prototypesPath.AppendChild( TfToken( baseName ) );
+		for( int suffix = 1; context.GetPrimAtPath( prototypePath ); ++suffix )
 		{
-			context.CreateProperty(
-				TfToken( _PRIVATE_TOKENS->primvarsPrefix.GetString() + usdUvData.first.GetString() ),
-				SdfValueTypeNames->TexCoord2fArray,
-				// TODO - We technically do not required to keep track of the actual coordinates themselves anymore past this point, so the copy constructor is unfortunately unnecessary
-				VtValue( usdUvData.second ),
-				nullptr,
-				{ { UsdGeomTokens->interpolation, VtValue( UsdGeomTokens->faceVarying ) },
-				  helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->geometry ) } );
+			prototypePath = prototypesPath.AppendChild( TfToken( TfStringPrintf( "%s_%d", baseName.c_str(), suffix ) ) );
 		}
+		return prototypePath;
+	}
 
-		// Varying/Interpolated properties
-		context.CreateProperty(
-			UsdGeomTokens->points,
-			SdfValueTypeNames->Point3fArray,
-			VtValue( converters::meshPoints( context.GetNode() ) ),
-			{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->geometry ) } );
+	/// Returns the path of the SkelAnimation of the Skeleton at \p skeletonPath, which sits next to the Skeleton.
+	/// The animation is added and bound to the Skeleton on first use, by the Skeleton itself or a mesh bound to it.
+	SdfPath getOrAddSkelAnimation( remedy::FbxNodeReaderContext& context, const SdfPath& skeletonPath )
+	{
+		const SdfPath animationPath
+			= skeletonPath.GetParentPath().AppendChild( TfToken( std::string( "Animation" ) + skeletonPath.GetName() ) );
+		if( context.GetPrimAtPath( animationPath ) )
+		{
+			return animationPath;
+		}
 
-		context.CreateProperty(
-			TfToken( _PRIVATE_TOKENS->primvarsPrefix.GetString() + UsdGeomTokens->normals.GetString() ),
-			SdfValueTypeNames->Normal3fArray,
-			VtValue( converters::meshNormals( context.GetNode() ) ),
+		getOrAddChildPrim( context, animationPath ).typeName = UsdFbxPrimTypeNames->SkelAnimation;
+		getOrAddChildPrim( context, skeletonPath );
+		context.CreateRelationship(
+			skeletonPath.AppendProperty( UsdSkelTokens->skelAnimationSource ),
+			animationPath,
+			{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->skelanimation ) } );
+		return animationPath;
+	}
+
+	/// Adds the blendShapes and blendShapeWeights of \p weights to the SkelAnimation of the Skeleton at \p skeletonPath
+	void addBlendShapeAnimation(
+		remedy::FbxNodeReaderContext& context,
+		const SdfPath& skeletonPath,
+		const std::shared_ptr< remedy::FbxBlendShapeWeights >& weights )
+	{
+		const SdfPath animationPath = getOrAddSkelAnimation( context, skeletonPath );
+		weights->blendShapes = &context.CreateUniformProperty(
+			animationPath.AppendProperty( UsdSkelTokens->blendShapes ),
+			SdfValueTypeNames->TokenArray,
+			VtValue( weights->names ),
+			{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->skelanimation ) } );
+		weights->blendShapeWeights = &context.CreateProperty(
+			animationPath.AppendProperty( UsdSkelTokens->blendShapeWeights ),
+			SdfValueTypeNames->FloatArray,
+			VtValue( weights->defaultWeights ),
+			{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->skelanimation ) } );
+
+		if( context.GetAnimLayer() == nullptr )
+		{
+			return;
+		}
+
+		// Meshes keep appending channels until the scene has been read, by the time frames are sampled the list is final
+		auto evaluator = context.GetNode()->GetScene()->GetAnimationEvaluator();
+		const auto samples = std::make_shared< std::vector< std::tuple< UsdTimeCode, VtValue > > >();
+		context.GetAnimationSampler().AddChannel(
+			[ weights, samples, evaluator ]( FbxTime time, UsdTimeCode timeCode )
+			{
+				VtFloatArray values( weights->channels.size() );
+				for( size_t channelId = 0; channelId < weights->channels.size(); ++channelId )
+				{
+					const double percent
+						= evaluator->GetPropertyValue< FbxDouble >( weights->channels[ channelId ]->DeformPercent, time );
+					values[ channelId ] = static_cast< float >( percent / weights->fullWeights[ channelId ] );
+				}
+				samples->emplace_back( timeCode, VtValue( std::move( values ) ) );
+			},
+			[ weights, samples, &animatedChannels = context.GetAnimatedChannels() ]()
+			{
+				// Weights without curves keep their default values. The curves decide rather than the samples, which
+				// may hold a single frame when clipFrames splits the take.
+				const bool isAnimated = std::any_of(
+					weights->channels.cbegin(),
+					weights->channels.cend(),
+					[ & ]( const FbxBlendShapeChannel* channel )
+					{ return animatedChannels.IsAnimated( channel->DeformPercent ); } );
+				if( isAnimated )
+				{
+					weights->blendShapeWeights->timeSamples = std::move( *samples );
+				}
+			} );
+	}
+
+	/// Returns the blend shape weights bound through the Skeleton at \p skeletonPath. The SkelAnimation sits next to
+	/// the Skeleton, when the parent of the Skeleton has not been read yet readSkeleton adds the animation instead.
+	remedy::FbxBlendShapeWeights& getOrAddBlendShapeWeights( remedy::FbxNodeReaderContext& context, const SdfPath& skeletonPath )
+	{
+		auto& weights = context.GetBlendShapeWeights()[ skeletonPath ];
+		if( !weights )
+		{
+			weights = std::make_shared< remedy::FbxBlendShapeWeights >();
+			if( context.GetPrimAtPath( skeletonPath.GetParentPath() ) )
+			{
+				addBlendShapeAnimation( context, skeletonPath, weights );
+			}
+		}
+		return *weights;
+	}
+
+	/// Writes the blend shape channels of the mesh as UsdSkelBlendShape children holding sparse offsets, driven by the
+	/// SkelAnimation of \p skeletonPath. Meshes that are not skinned get a Skeleton without joints to carry the weights.
+	void readBlendShapes(
+		remedy::FbxNodeReaderContext& context,
+		const VtVec3fArray& restPoints,
+		SdfPath skeletonPath,
+		TfTokenVector& apiSchemas )
+	{
+		auto* mesh = static_cast< FbxMesh* >( context.GetNode()->GetNodeAttribute() );
+		std::vector< FbxBlendShapeChannel* > channels;
+		for( int deformerId = 0; deformerId < mesh->GetDeformerCount( FbxDeformer::eBlendShape ); ++deformerId )
+		{
+			auto* blendShape = static_cast< FbxBlendShape* >( mesh->GetDeformer( deformerId, FbxDeformer::eBlendShape ) );
+			for( int channelId = 0; channelId < blendShape->GetBlendShapeChannelCount(); ++channelId )
+			{
+				FbxBlendShapeChannel* channel = blendShape->GetBlendShapeChannel( channelId );
+				if( channel != nullptr && channel->GetTargetShapeCount() > 0 )
+				{
+					channels.push_back( channel );
+				}
+			}
+		}
+
+		// Channels whose targets do not move a single point have nothing to offset
+		std::vector< std::pair< FbxBlendShapeChannel*, converters::BlendShapeTargets > > channelTargets;
+		size_t numPointIndices = 0;
+		for( FbxBlendShapeChannel* channel : channels )
+		{
+			auto targets = converters::blendShapeTargets( context.GetConversion(), context.GetNode(), restPoints, channel );
+			if( targets.pointIndices.empty() )
+			{
+				TF_DEBUG( USDFBX ).Msg( "UsdFbx - Blend shape \"%s\" does not move any point, skipping\n", channel->GetName() );
+				continue;
+			}
+			numPointIndices += targets.pointIndices.size();
+			channelTargets.emplace_back( channel, std::move( targets ) );
+		}
+		if( channelTargets.empty() )
+		{
+			return;
+		}
+
+		if( skeletonPath.IsEmpty() )
+		{
+			skeletonPath = context.GetPath().GetParentPath().AppendChild(
+				TfToken( std::string( "BlendShapes" ) + context.GetPath().GetName() ) );
+			getOrAddChildPrim( context, skeletonPath ).typeName = UsdFbxPrimTypeNames->Skeleton;
+			context.CreateUniformProperty(
+				skeletonPath.AppendProperty( UsdSkelTokens->joints ),
+				SdfValueTypeNames->TokenArray,
+				VtValue( VtTokenArray() ),
+				{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->skeleton ) } );
+
+			if( std::find( apiSchemas.cbegin(), apiSchemas.cend(), UsdFbxSchemaTokens->SkelBindingAPI ) == apiSchemas.cend() )
+			{
+				apiSchemas.push_back( UsdFbxSchemaTokens->SkelBindingAPI );
+			}
+			context.CreateRelationship(
+				UsdSkelTokens->skelSkeleton,
+				skeletonPath,
+				{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->skeleton ) } );
+		}
+
+		remedy::FbxBlendShapeWeights& weights = getOrAddBlendShapeWeights( context, skeletonPath );
+
+		// The children of the mesh are only added once its readers are done
+		std::set< std::string > usedNames;
+		for( int childId = 0; childId < context.GetNode()->GetChildCount(); ++childId )
+		{
+			usedNames.insert( remedy::cleanName( context.GetNode()->GetChild( childId )->GetName() ) );
+		}
+		std::set< std::string > animationNameSet;
+		for( const TfToken& name : weights.names )
+		{
+			animationNameSet.insert( name.GetString() );
+		}
+		auto uniqueName = []( const std::string& name, const std::set< std::string >& names )
+		{
+			std::string attempt = name;
+			for( int i = 1; names.find( attempt ) != names.end(); ++i )
+			{
+				attempt = TfStringPrintf( "%s_%d", name.c_str(), i );
+			}
+			return attempt;
+		};
+
+		VtTokenArray blendShapeNames;
+		SdfPathVector blendShapePaths;
+		for( auto& [ channel, targets ] : channelTargets )
+		{
+			const std::string primName = uniqueName( remedy::cleanName( channel->GetName() ), usedNames );
+			usedNames.insert( primName );
+			const SdfPath blendShapePath = context.GetPath().AppendChild( TfToken( primName ) );
+			getOrAddChildPrim( context, blendShapePath ).typeName = UsdFbxPrimTypeNames->BlendShape;
+
+			context.CreateUniformProperty(
+				blendShapePath.AppendProperty( UsdSkelTokens->offsets ),
+				SdfValueTypeNames->Vector3fArray,
+				VtValue( std::move( targets.offsets.back() ) ) );
+			context.CreateUniformProperty(
+				blendShapePath.AppendProperty( UsdSkelTokens->pointIndices ),
+				SdfValueTypeNames->IntArray,
+				VtValue( targets.pointIndices ) );
+
+			// In-betweens are reached at a fraction of the full target
+			const double fullWeight = targets.fullWeights.back();
+			std::set< std::string > inbetweenNames;
+			for( size_t targetId = 0; targetId + 1 < targets.offsets.size(); ++targetId )
+			{
+				const std::string inbetweenName = uniqueName( remedy::cleanName( targets.names[ targetId ] ), inbetweenNames );
+				inbetweenNames.insert( inbetweenName );
+				const auto weight = static_cast< float >( targets.fullWeights[ targetId ] / fullWeight );
+				context.CreateUniformProperty(
+					blendShapePath.AppendProperty( TfToken( "inbetweens:" + inbetweenName ) ),
+					SdfValueTypeNames->Vector3fArray,
+					VtValue( std::move( targets.offsets[ targetId ] ) ),
+					{ { UsdSkelTokens->weight, VtValue( weight ) } } );
+			}
+
+			// Names have to be unique over every mesh bound to the same Skeleton
+			const std::string animationName = animationNameSet.count( primName ) == 0
+												  ? primName
+												  : uniqueName( context.GetPath().GetName() + "_" + primName, animationNameSet );
+			animationNameSet.insert( animationName );
+
+			blendShapeNames.push_back( TfToken( animationName ) );
+			blendShapePaths.push_back( blendShapePath );
+			weights.channels.push_back( channel );
+			weights.fullWeights.push_back( fullWeight );
+			weights.names.push_back( TfToken( animationName ) );
+			weights.defaultWeights.push_back( static_cast< float >( channel->DeformPercent.Get() / fullWeight ) );
+		}
+
+		if( weights.blendShapes != nullptr )
+		{
+			weights.blendShapes->value = VtValue( weights.names );
+			weights.blendShapeWeights->value = VtValue( weights.defaultWeights );
+		}
+		context.CreateUniformProperty(
+			UsdSkelTokens->skelBlendShapes,
+			SdfValueTypeNames->TokenArray,
+			VtValue( blendShapeNames ),
+			{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->skeleton ) } );
+		auto& targetsRel = context.CreateRelationship(
+			UsdSkelTokens->skelBlendShapeTargets,
+			blendShapePaths.front(),
+			{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->skeleton ) } );
+		targetsRel.targetPaths = std::move( blendShapePaths );
+
+		TF_DEBUG( USDFBX )
+			.Msg(
+				"UsdFbx - %zu blend shapes on \"%s\" keep %zu of %zu points\n",
+				channelTargets.size(),
+				context.GetNode()->GetName(),
+				numPointIndices,
+				restPoints.size() * channelTargets.size() );
+	}
+
+	/// Deforms the points and normals of a skinned mesh every frame, instead of binding it to its Skeleton
+	void readBakedSkinning(
+		remedy::FbxNodeReaderContext& context,
+		const std::vector< const FbxCluster* >& clusters,
+		const std::shared_ptr< remedy::BakedSkinning >& skinning,
+		remedy::FbxNodeReaderContext::Property& pointsProp,
+		remedy::FbxNodeReaderContext::Property& normalsProp )
+	{
+		// Skinning transforms follow the Gf row vector convention. Points go from the mesh at bind time into the space
+		// of the joint at bind time, then out of the joint at the current time and into the space of the mesh. Every
+		// transform is converted like the rest points are
+		const remedy::FbxSceneConversion conversion = context.GetConversion();
+		std::vector< GfMatrix4d > bindTransforms;
+		std::vector< FbxNode* > links;
+		for( const FbxCluster* cluster : clusters )
+		{
+			FbxAMatrix meshBindTransform;
+			FbxAMatrix linkBindTransform;
+			cluster->GetTransformMatrix( meshBindTransform );
+			cluster->GetTransformLinkMatrix( linkBindTransform );
+			bindTransforms.push_back(
+				converters::globalTransform( conversion, meshBindTransform )
+				* converters::globalTransform( conversion, linkBindTransform ).GetInverse() );
+
+			const remedy::FbxSkeletonTable::Skeleton& skeleton = context.GetSkeletons().GetSkeleton( cluster->GetLink() );
+			links.push_back( skeleton.joints[ context.GetSkeletons().GetJointIndex( cluster->GetLink() ) ].node );
+		}
+
+		FbxNode* meshNode = context.GetNode();
+		auto evaluator = meshNode->GetScene()->GetAnimationEvaluator();
+		context.GetAnimationSampler().AddChannel(
+			[ skinning, bindTransforms, links, meshNode, evaluator, conversion ]( FbxTime time, UsdTimeCode timeCode )
+			{
+				const GfMatrix4d worldToMesh
+					= converters::globalTransform( conversion, evaluator->GetNodeGlobalTransform( meshNode, time ) ).GetInverse();
+				std::vector< GfMatrix4d > skinningTransforms( links.size() );
+				for( size_t influence = 0; influence < links.size(); ++influence )
+				{
+					const FbxAMatrix linkGlobalTransform = evaluator->GetNodeGlobalTransform( links[ influence ], time );
+					const GfMatrix4d linkToWorld = converters::globalTransform( conversion, linkGlobalTransform );
+					skinningTransforms[ influence ] = bindTransforms[ influence ] * linkToWorld * worldToMesh;
+				}
+				skinning->AddFrame( timeCode.GetValue(), skinningTransforms );
+			},
+			[ skinning, &pointsProp, &normalsProp ]()
+			{
+				if( skinning->GetTimes().empty() )
+				{
+					return;
+				}
+
+				using Channel = remedy::BakedSkinningSamples::Channel;
+				pointsProp.timeSampleSource = std::make_shared< remedy::BakedSkinningSamples >( skinning, Channel::Points );
+				if( skinning->HasNormals() )
+				{
+					normalsProp.timeSampleSource
+						= std::make_shared< remedy::BakedSkinningSamples >( skinning, Channel::Normals );
+				}
+			} );
+	}
+
+	/// Opens the files of \p cache for streaming, the FBX SDK is only used to find them
+	std::shared_ptr< const remedy::VertexCache > openVertexCache(
+		FbxCache* cache,
+		const std::string& channel,
+		double framesPerSecond )
+	{
+		FbxString relativePath;
+		FbxString absolutePath;
+		switch( cache->GetCacheFileFormat() )
+		{
+		case FbxCache::eMaxPointCacheV2:
+			cache->GetCacheFileName( relativePath, absolutePath );
+			return remedy::VertexCache::OpenPc2( absolutePath.Buffer(), framesPerSecond );
+		case FbxCache::eMayaCache:
+		{
+			// The description file lists the data files, with one file for all frames or one per frame
+			if( !cache->OpenFileForRead() )
+			{
+				TF_WARN( "Unable to open the description of vertex cache \"%s\"", cache->GetName() );
+				return nullptr;
+			}
+			std::vector< std::string > paths;
+			for( int fileId = 0; fileId < cache->GetCacheDataFileCount(); ++fileId )
+			{
+				if( cache->GetCacheDataFileName( fileId, relativePath, absolutePath ) )
+				{
+					paths.emplace_back( absolutePath.Buffer() );
+				}
+			}
+			cache->CloseFile();
+			return remedy::VertexCache::OpenMayaCache( paths, channel );
+		}
+		default:
+			TF_WARN( "Vertex cache \"%s\" has an unsupported file format", cache->GetName() );
+			return nullptr;
+		}
+	}
+
+	/// Streams the points of the mesh from the first active vertex cache deformer. Frames are read from the cache
+	/// files when USD asks for them, nothing but the location of each frame is kept in memory.
+	void readVertexCache( remedy::FbxNodeReaderContext& context, remedy::FbxNodeReaderContext::Property& pointsProp )
+	{
+		auto* mesh = static_cast< FbxMesh* >( context.GetNode()->GetNodeAttribute() );
+		for( int deformerId = 0; deformerId < mesh->GetDeformerCount( FbxDeformer::eVertexCache ); ++deformerId )
+		{
+			auto* deformer = static_cast< FbxVertexCacheDeformer* >( mesh->GetDeformer( deformerId, FbxDeformer::eVertexCache ) );
+			const auto channelType = static_cast< FbxVertexCacheDeformer::ECacheChannelType >( deformer->Type.Get() );
+			if( !deformer->Active.Get() || deformer->GetCache() == nullptr
+				|| ( channelType != FbxVertexCacheDeformer::ePositions && channelType != FbxVertexCacheDeformer::eUnknown ) )
+			{
+				continue;
+			}
+
+			const FbxScene* scene = context.GetNode()->GetScene();
+			auto cache = openVertexCache(
+				deformer->GetCache(),
+				deformer->Channel.Get().Buffer(),
+				FbxTime::GetFrameRate( scene->GetGlobalSettings().GetTimeMode() ) );
+			if( !cache )
+			{
+				continue;
+			}
+			if( cache->GetNumPoints() != static_cast< size_t >( mesh->GetControlPointsCount() ) )
+			{
+				TF_WARN(
+					"Vertex cache of \"%s\" has %zu points for %d control points, ignoring it",
+					context.GetNode()->GetName(),
+					cache->GetNumPoints(),
+					mesh->GetControlPointsCount() );
+				continue;
+			}
+
+			TF_DEBUG( USDFBX )
+				.Msg(
+					"UsdFbx - Streaming %zu frames of \"%s\" from its vertex cache\n",
+					cache->GetNumFrames(),
+					context.GetNode()->GetName() );
+
+			// The scene frames are only known once sampling starts, the frames of the cache are matched to them by time
+			const GfMatrix4d geometryToNode
+				= helpers::toGfMatrix( converters::geometryToNodeTransform( context.GetNode() ) ) * context.GetConversion().axis;
+			const auto times = std::make_shared< std::pair< std::vector< double >, std::vector< double > > >();
+			context.GetAnimationSampler().AddChannel(
+				[ times ]( FbxTime time, UsdTimeCode timeCode )
+				{
+					times->first.push_back( timeCode.GetValue() );
+					times->second.push_back( time.GetSecondDouble() );
+				},
+				[ cache, times, geometryToNode, &pointsProp ]()
+				{
+					if( !times->first.empty() )
+					{
+						pointsProp.timeSampleSource = std::make_shared< remedy::VertexCacheSamples >(
+							cache,
+							std::move( times->first ),
+							std::move( times->second ),
+							geometryToNode );
+					}
+				} );
+			return;
+		}
+	}
+
+	/// Converts the mesh of the node into the prim of \p context
+	void readMeshGeometry( remedy::FbxNodeReaderContext& context )
+	{
+		context.GetOrAddPrim().typeName = UsdFbxPrimTypeNames->Mesh;
+		TfTokenVector apiSchemas;
+
+		const FbxNode* fbxNode = context.GetNode();
+		if( !fbxNode->GetNodeAttribute() || fbxNode->GetNodeAttributeCount() == 0
+			|| fbxNode->GetNodeAttribute()->GetAttributeType() != FbxNodeAttribute::eMesh )
+		{
+			return;
+		}
+
+		auto textureCoordinates = getMeshTextureCoordinates( fbxNode );
+		for( const auto& [ fbxUvName, usdUvData ] : textureCoordinates )
+		{
+			context.CreateProperty(
+				TfToken( _PRIVATE_TOKENS->primvarsPrefix.GetString() + usdUvData.first.GetString() ),
+				SdfValueTypeNames->TexCoord2fArray,
+				// TODO - We technically do not required to keep track of the actual coordinates themselves anymore past this point, so the copy constructor is unfortunately unnecessary
+				VtValue( usdUvData.second ),
+				nullptr,
+				{ { UsdGeomTokens->interpolation, VtValue( UsdGeomTokens->faceVarying ) },
+				  helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->geometry ) } );
+		}
+
+		// Varying/Interpolated properties
+		const VtVec3fArray points = converters::meshPoints( context.GetConversion(), context.GetNode() );
+		auto& pointsProp = context.CreateProperty(
+			UsdGeomTokens->points,
+			SdfValueTypeNames->Point3fArray,
+			VtValue( points ),
+			{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->geometry ) } );
+
+		const VtVec3fArray normals = converters::meshNormals( context.GetConversion(), context.GetNode() );
+		auto& normalsProp = context.CreateProperty(
+			TfToken( _PRIVATE_TOKENS->primvarsPrefix.GetString() + UsdGeomTokens->normals.GetString() ),
+			SdfValueTypeNames->Normal3fArray,
+			VtValue( normals ),
 			{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->geometry ),
 			  { UsdGeomTokens->interpolation, VtValue( UsdGeomTokens->faceVarying ) } } );
 
 		context.CreateProperty(
 			TfToken( _PRIVATE_TOKENS->primvarsPrefix.GetString() + UsdGeomTokens->tangents.GetString() ),
 			SdfValueTypeNames->Normal3fArray,
-			VtValue( converters::meshTangents( context.GetNode() ) ),
+			VtValue( converters::meshTangents( context.GetConversion(), context.GetNode() ) ),
 			{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->geometry ),
 			  { UsdGeomTokens->interpolation, VtValue( UsdGeomTokens->faceVarying ) } } );
 
@@ -1677,20 +2436,47 @@ namespace
 			apiSchemas.push_back( UsdFbxSchemaTokens->MaterialBindingAPI );
 		}
 
+		SdfPath boundSkeletonPath;
+		bool isSkinningBaked = false;
 		if( const auto* skin = helpers::getSkin( static_cast< const FbxMesh* >( fbxNode->GetNodeAttribute() ) ) )
 		{
-			apiSchemas.push_back( UsdFbxSchemaTokens->SkelBindingAPI );
+			const bool bakeSkinning = context.GetDataReader().GetOptions().bakeSkinning;
+			if( !bakeSkinning )
+			{
+				apiSchemas.push_back( UsdFbxSchemaTokens->SkelBindingAPI );
+			}
 
-			const auto& [ joints, jointIndices, jointWeights, elementSize, skeletonPath ]
-				= converters::getBindingData( skin, static_cast< const FbxMesh* >( fbxNode->GetNodeAttribute() ) );
+			const auto& [ joints, clusters, jointIndices, jointWeights, elementSize, skeletonPath ] = converters::getBindingData(
+				skin,
+				static_cast< const FbxMesh* >( fbxNode->GetNodeAttribute() ),
+				context.GetSkeletons(),
+				context.GetDataReader().GetOptions() );
 
 			if( joints.empty() )
 			{
 				TF_WARN( "A skin for \"%s\" has been defined, but no joints could be extracted!", fbxNode->GetName() );
 			}
+			else if( bakeSkinning )
+			{
+				isSkinningBaked = true;
+				readBakedSkinning(
+					context,
+					clusters,
+					std::make_shared< remedy::BakedSkinning >(
+						points,
+						normals,
+						faceVertexIndices,
+						jointIndices,
+						jointWeights,
+						elementSize ),
+					pointsProp,
+					normalsProp );
+			}
 			else
 			{
-				auto matrix = fbxNode->GetScene()->GetAnimationEvaluator()->GetNodeGlobalTransform( context.GetNode() );
+				FbxAMatrix matrix = helpers::toFbxAMatrix( converters::globalTransform(
+					context.GetConversion(),
+					fbxNode->GetScene()->GetAnimationEvaluator()->GetNodeGlobalTransform( context.GetNode() ) ) );
 				matrix.SetS( { 1.0, 1.0, 1.0 } );
 				const GfMatrix4d geomBindTransform( helpers::toGfMatrix( matrix ) );
 
@@ -1735,6 +2521,33 @@ namespace
 					UsdSkelTokens->skelSkeleton,
 					skeletonPath,
 					{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->skeleton ) } );
+				boundSkeletonPath = skeletonPath;
+			}
+		}
+
+		// UsdSkel applies the blend shapes, once the skinning is baked there is no binding left to drive them
+		if( !isSkinningBaked )
+		{
+			readBlendShapes( context, points, boundSkeletonPath, apiSchemas );
+		}
+		else if( static_cast< const FbxMesh* >( fbxNode->GetNodeAttribute() )->GetDeformerCount( FbxDeformer::eBlendShape ) > 0 )
+		{
+			TF_WARN( "The blend shapes of \"%s\" are not baked with its skinning and have been skipped", fbxNode->GetName() );
+		}
+
+		readVertexCache( context, pointsProp );
+
+		// The other files of a sequence only provide points, they are matched to the meshes of this one by node names
+		if( context.GetDataReader().GetOptions().sequence )
+		{
+			const std::string nodeNamePath = remedy::GetNodeNamePath( fbxNode );
+			const auto [ it, isInserted ] = context.GetSequencePoints().emplace( nodeNamePath, &pointsProp );
+			if( !isInserted && it->second != nullptr )
+			{
+				TF_WARN(
+					"Several meshes are named \"%s\", their points are not read from the other files of the sequence",
+					nodeNamePath.c_str() );
+				it->second = nullptr;
 			}
 		}
 
@@ -1764,6 +2577,65 @@ namespace
 		}
 	}
 
+	/// Meshes shared by several nodes, converted once for all of them. Deformed meshes are bound, cached or read from
+	/// a sequence per node and are converted for every node.
+	bool isSharedMesh( const FbxNode* node, const remedy::UsdFbxDataReader::Options& options )
+	{
+		const auto* mesh = static_cast< const FbxMesh* >( node->GetNodeAttribute() );
+		return mesh->GetNodeCount() > 1 && mesh->GetDeformerCount() == 0 && !options.sequence;
+	}
+
+	/// Nodes converting the mesh they share into the same prim, nothing of their own ends up in it
+	bool isSameMeshConversion( const FbxNode* node, const FbxNode* other )
+	{
+		if( converters::geometryToNodeTransform( node ) != converters::geometryToNodeTransform( other )
+			|| node->GetMaterialCount() != other->GetMaterialCount() )
+		{
+			return false;
+		}
+		for( int materialIndex = 0; materialIndex < node->GetMaterialCount(); ++materialIndex )
+		{
+			if( node->GetMaterial( materialIndex ) != other->GetMaterial( materialIndex ) )
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void readMesh( remedy::FbxNodeReaderContext& context )
+	{
+		TF_DEBUG( USDFBX_FBX_READERS ).Msg( "UsdFbx::FbxReaders - readMesh for \"%s\"\n", context.GetNode()->GetName() );
+
+		const FbxNode* fbxNode = context.GetNode();
+		if( !fbxNode->GetNodeAttribute() || fbxNode->GetNodeAttributeCount() == 0
+			|| fbxNode->GetNodeAttribute()->GetAttributeType() != FbxNodeAttribute::eMesh )
+		{
+			context.GetOrAddPrim().typeName = UsdFbxPrimTypeNames->Mesh;
+			return;
+		}
+
+		if( !isSharedMesh( fbxNode, context.GetDataReader().GetOptions() ) )
+		{
+			readMeshGeometry( context );
+			return;
+		}
+
+		// The mesh is converted once into a prototype, every node sharing it references it
+		const SdfPath prototypePath = remedy::GetOrAddMeshPrototype( context );
+		TF_DEBUG( USDFBX_FBX_READERS )
+			.Msg( "UsdFbx::FbxReaders - <%s> instances <%s>\n", context.GetPath().GetText(), prototypePath.GetText() );
+
+		auto& prim = context.GetOrAddPrim();
+		prim.typeName = UsdFbxPrimTypeNames->Mesh;
+		prim.prototype = prototypePath;
+		// USD ignores the children of an instance, nodes with children of their own only share the data
+		if( fbxNode->GetChildCount() == 0 )
+		{
+			prim.metadata[ SdfFieldKeys->Instanceable ] = VtValue( true );
+		}
+	}
+
 	void readSkeletonAnimation( remedy::FbxNodeReaderContext& context )
 	{
 		TF_DEBUG( USDFBX_FBX_READERS ).Msg( "UsdFbx::FbxReaders - readSkeletonAnim for \"%s\"\n", context.GetNode()->GetName() );
@@ -1774,7 +2646,6 @@ namespace
 
 		const FbxNode* fbxNode = context.GetNode();
 		const FbxNode* parent = fbxNode->GetParent();
-		const auto pSkeleton = static_cast< const FbxSkeleton* >( fbxNode->GetNodeAttribute() );
 
 		auto isSkeleton = []( const FbxNode* node )
 		{
@@ -1789,46 +2660,8 @@ namespace
 			return;
 		}
 
-		const TfToken skelAnimationPrimName( std::string( "Animation" ) + remedy::cleanName( fbxNode->GetName() ) );
-
-		const auto parentPath = context.GetPath().GetParentPath();
-		const auto skelAnimPrimPath = parentPath.AppendChild( skelAnimationPrimName );
-
-		if( auto parentPrim = context.GetPrimAtPath( parentPath ) )
-		{
-			parentPrim.value()->children.push_back( skelAnimationPrimName );
-		}
-		else
-		{
-			TF_WARN( "readSkeletonAnimation: Unable to find a parent at path @%s@", parentPath.GetAsString().c_str() );
-		}
-
-		auto& skeletonAnimPrim = context.AddPrim( skelAnimPrimPath );
-		skeletonAnimPrim.typeName = UsdFbxPrimTypeNames->SkelAnimation;
-
-		std::vector skeletonHierarchy{ pSkeleton };
-		// Using a fully qualified type so we can call the lambda recursively
-		std::function< void( const FbxSkeleton* ) > collectSkeletonHierarchy = [ & ]( const FbxSkeleton* skeleton )
-		{
-			for( size_t i = 0, n = skeleton->GetNode()->GetChildCount(); i < n; ++i )
-			{
-				const FbxNode* child = skeleton->GetNode()->GetChild( static_cast< int >( i ) );
-				if( !isSkeleton( child ) )
-				{
-					TF_WARN(
-						"\"%s\" is not an FbxSkeleton node, but is part of a "
-						"skeleton hierarchy! It and its children will be ignored",
-						child->GetName() );
-					continue;
-				}
-
-				const FbxSkeleton* childSkeleton = static_cast< const FbxSkeleton* >( child->GetNodeAttribute() );
-				skeletonHierarchy.push_back( childSkeleton );
-				collectSkeletonHierarchy( childSkeleton );
-			}
-		};
-		collectSkeletonHierarchy( pSkeleton );
-		VtTokenArray skeletonTokens = converters::skeletonHierarchyToTokenList( skeletonHierarchy );
+		const remedy::FbxSkeletonTable::Skeleton& skeleton = context.GetSkeletons().GetSkeleton( fbxNode );
+		const SdfPath skelAnimPrimPath = getOrAddSkelAnimation( context, skeleton.primPath );
 
 		struct Property
 		{
@@ -1837,132 +2670,146 @@ namespace
 			std::vector< VtValue > values = {};
 			VtTokenArray ownerPaths = {};
 			std::map< UsdTimeCode, std::vector< VtValue > > timeSamples = {};
+			std::vector< remedy::FbxAnimationSampler::SampleFn > samplers = {};
 		};
 
-		FbxTime fbxSampleTime = context.GetAnimTimeSpan().GetStart();
-		const FbxTime fbxFrameIncrement( FbxTime::GetOneFrameValue( fbxNode->GetScene()->GetGlobalSettings().GetTimeMode() ) );
-		auto evaluator = fbxNode->GetScene()->GetAnimationEvaluator();
-		const auto numFrames = static_cast< uint64_t >( context.GetAnimTimeSpan().GetDuration().GetFrameCount() );
-		std::vector< std::tuple< UsdTimeCode, VtValue > > translations;
-		std::vector< std::tuple< UsdTimeCode, VtValue > > rotations;
-		std::vector< std::tuple< UsdTimeCode, VtValue > > scales;
-		std::map< TfToken, Property > propertiesMap;
+		// Everything the animation sampler fills in once the scene has been read
+		struct SkelAnimationSamples
+		{
+			std::vector< std::tuple< UsdTimeCode, VtValue > > translations;
+			std::vector< std::tuple< UsdTimeCode, VtValue > > rotations;
+			size_t numFrames = 0;
+			std::map< TfToken, Property > propertiesMap;
+			std::shared_ptr< remedy::QuantizedSkelAnimation > quantizedAnimation;
+		};
+		const auto samples = std::make_shared< SkelAnimationSamples >();
 
 		// Parse user properties differently than per-frame skeleton transforms.
-		size_t idx = 0;
-		for( auto* skeleton : skeletonHierarchy )
+		for( const remedy::FbxSkeletonTable::Joint& joint : skeleton.joints )
 		{
-			auto fbxProps = helpers::getAnimatedUserProperties( skeleton->GetNode(), context.GetAnimLayer() );
-			if( skeleton->GetNode()->Visibility.GetCurveNode( context.GetAnimLayer() ) )
+			if( !context.GetAnimatedChannels().IsAnimated( joint.node ) )
+			{
+				continue;
+			}
+
+			std::vector< std::pair< FbxProperty, FbxAnimCurveNode* > > fbxProps;
+			for( const auto& userProperty : context.GetPropertyIndex( joint.node ).GetUserProperties() )
+			{
+				if( userProperty.curveNode != nullptr )
+				{
+					fbxProps.emplace_back( userProperty.property, userProperty.curveNode );
+				}
+			}
+			if( const auto curveNode = context.GetAnimatedChannels().GetCurveNode( joint.node->Visibility ) )
 			{
-				fbxProps.push_back( skeleton->GetNode()->Visibility );
+				fbxProps.emplace_back( joint.node->Visibility, curveNode );
 			}
 
-			TfToken skeletonPath = skeletonTokens[ idx++ ];
-			for( auto& fbxProp : fbxProps )
+			for( auto& [ fbxProp, curveNode ] : fbxProps )
 			{
 				helpers::FbxToUsd converter{ &fbxProp };
-				auto propertiesMapIt = propertiesMap.find( converter.getNameAsUserProperty() );
-				if( propertiesMapIt == propertiesMap.end() )
+				auto propertiesMapIt = samples->propertiesMap.find( converter.getNameAsUserProperty() );
+				if( propertiesMapIt == samples->propertiesMap.end() )
 				{
-					propertiesMapIt = std::get< 0 >( propertiesMap.insert(
+					propertiesMapIt = std::get< 0 >( samples->propertiesMap.insert(
 						{ converter.getNameAsUserProperty(),
 						  { converter.getNameAsUserProperty(), converter.getSdfTypeName().GetArrayType() } } ) );
 				}
 
 				auto& prop = propertiesMapIt->second;
-				auto timeAndValue = helpers::getPropertyAnimation(
-					skeleton->GetNode(),
-					fbxProp,
-					context.GetAnimLayer(),
-					context.GetAnimTimeSpan() );
-				for( auto& [ time, value ] : timeAndValue )
-				{
-					auto it = prop.timeSamples.find( time );
-					if( it == prop.timeSamples.end() )
-					{
-						it = std::get< 0 >( prop.timeSamples.insert( { time, {} } ) );
-					}
-					it->second.push_back( value );
-				}
+				prop.samplers.push_back(
+					helpers::getPropertySampler( fbxProp, curveNode, context.GetAnimatedChannels().IsLayered() ) );
 				prop.values.push_back( converter.getValue() );
-				prop.ownerPaths.push_back( skeletonPath );
+				prop.ownerPaths.push_back( joint.path );
 			}
 		}
 
-		for( uint64_t frame = 0; frame <= numFrames; ++frame )
+		// Joints that hold their rest transform over the whole take are left out, UsdSkel falls back to the
+		// restTransforms of the Skeleton for them
+		std::vector< FbxNode* > animatedJoints;
+		VtTokenArray animatedJointPaths;
+		for( const remedy::FbxSkeletonTable::Joint& joint : skeleton.joints )
 		{
-			VtVec3fArray skeletonTranslations;
-			VtQuatfArray skeletonRotations;
-			VtVec3hArray skeletonScales;
-			UsdTimeCode t( fbxSampleTime.GetFrameCountPrecise() );
-
-			for( const auto* skeleton : skeletonHierarchy )
+			if( helpers::isJointAnimated( joint.node, context.GetAnimatedChannels(), context.GetAnimTimeSpan().GetStart() ) )
 			{
-				const GfMatrix4d local
-					= helpers::toGfMatrix( evaluator->GetNodeLocalTransform( skeleton->GetNode(), fbxSampleTime ) );
-				skeletonTranslations.push_back( GfVec3f( local.ExtractTranslation() ) );
-				skeletonRotations.push_back( GfQuatf( local.ExtractRotationQuat() ) );
-				skeletonScales.push_back( GfVec3h( 1.0f, 1.0f, 1.0f ) );
+				animatedJoints.push_back( joint.node );
+				animatedJointPaths.push_back( joint.path );
 			}
+		}
+		TF_DEBUG( USDFBX )
+			.Msg(
+				"UsdFbx - %zu of %zu joints of <%s> are animated\n",
+				animatedJoints.size(),
+				skeleton.joints.size(),
+				skeleton.primPath.GetText() );
 
-			translations.push_back( { t, VtValue( skeletonTranslations ) } );
-			rotations.push_back( { t, VtValue( skeletonRotations ) } );
-			scales.push_back( { t, VtValue( skeletonScales ) } );
-
-			fbxSampleTime += fbxFrameIncrement;
+		// When quantizing, frames go straight into the compact representation and only the first frame is kept
+		// around as VtArrays for the default values
+		if( context.GetDataReader().GetOptions().quantizeSkelAnimation )
+		{
+			samples->quantizedAnimation = std::make_shared< remedy::QuantizedSkelAnimation >( animatedJoints.size() );
 		}
 
-		// Figure out if there is actual animation in the individual channels,
-		// fetching the matrices every frame doesn't really mean much if all the
-		// values are the same
-		const bool hasUniqueScales = !std::all_of(
-			scales.begin() + 1,
-			scales.end(),
-			[ & ]( const auto tup ) { return std::get< 1 >( tup ) == std::get< 1 >( scales[ 0 ] ); } );
+		// Animated joints go through the same conversion as the restTransforms the static ones fall back to
+		auto evaluator = fbxNode->GetScene()->GetAnimationEvaluator();
+		const double scaleFactor = converters::jointScaleFactor( fbxNode->GetScene() );
+		const remedy::FbxSceneConversion conversion = context.GetConversion();
+		auto sampleJoints = [ animatedJoints, evaluator, scaleFactor, conversion ](
+								FbxTime time,
+								VtVec3fArray& translations,
+								VtQuatfArray& rotations )
+		{
+			translations.reserve( animatedJoints.size() );
+			rotations.reserve( animatedJoints.size() );
+			for( FbxNode* joint : animatedJoints )
+			{
+				const GfMatrix4d local = converters::jointToMatrix(
+					converters::localTransform( conversion, joint, evaluator->GetNodeLocalTransform( joint, time ) ),
+					scaleFactor );
+				translations.push_back( GfVec3f( local.ExtractTranslation() ) );
+				rotations.push_back( GfQuatf( local.ExtractRotationQuat() ) );
+			}
+		};
+
+		VtVec3fArray defaultTranslations;
+		VtQuatfArray defaultRotations;
+		sampleJoints( context.GetAnimTimeSpan().GetStart(), defaultTranslations, defaultRotations );
+		const VtVec3hArray defaultScales( animatedJoints.size(), GfVec3h( 1.0f, 1.0f, 1.0f ) );
 
 		context.CreateUniformProperty(
 			skelAnimPrimPath.AppendProperty( UsdSkelTokens->joints ),
 			SdfValueTypeNames->TokenArray,
-			VtValue( skeletonTokens ),
+			VtValue( animatedJointPaths ),
 			{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->skelanimation ) } );
 
 		auto& translationsProp = context.CreateProperty(
 			skelAnimPrimPath.AppendProperty( UsdSkelTokens->translations ),
 			SdfValueTypeNames->Float3Array,
-			VtValue( std::get< 1 >( translations[ 0 ] ) ),
+			VtValue( defaultTranslations ),
 			{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->skelanimation ) } );
-		translationsProp.timeSamples = translations;
-
 		auto& rotationsProp = context.CreateProperty(
 			skelAnimPrimPath.AppendProperty( UsdSkelTokens->rotations ),
 			SdfValueTypeNames->QuatfArray,
-			VtValue( std::get< 1 >( rotations[ 0 ] ) ),
+			VtValue( defaultRotations ),
 			{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->skelanimation ) } );
-		rotationsProp.timeSamples = rotations;
-
-		auto& scalesProp = context.CreateProperty(
+		// Joint scales are forced to 1, they are written once and never sampled
+		context.CreateProperty(
 			skelAnimPrimPath.AppendProperty( UsdSkelTokens->scales ),
 			SdfValueTypeNames->Half3Array,
-			VtValue( std::get< 1 >( scales[ 0 ] ) ),
+			VtValue( defaultScales ),
 			{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->skelanimation ) } );
 
-		if( hasUniqueScales )
-		{
-			scalesProp.timeSamples = scales;
-		}
-
 		// Scalar property animations
-		for( auto& [ propName, prop ] : propertiesMap )
+		std::vector< std::pair< remedy::FbxNodeReaderContext::Property*, const Property* > > userProperties;
+		for( auto& [ propName, prop ] : samples->propertiesMap )
 		{
 			auto& usdProp = context.CreateProperty(
 				skelAnimPrimPath.AppendProperty( propName ),
 				prop.typeName,
-				VtValue( std::move( prop.values ) ),
+				VtValue( prop.values ),
 				{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->user ),
 				  { SdfFieldKeys->Custom, VtValue( true ) } } );
-			usdProp.timeSamples
-				= std::vector< std::tuple< UsdTimeCode, VtValue > >( prop.timeSamples.begin(), prop.timeSamples.end() );
+			userProperties.emplace_back( &usdProp, &prop );
 
 			// add special property to indicate this custom property's owner (joint
 			// path)
@@ -1974,21 +2821,89 @@ namespace
 				  { SdfFieldKeys->Custom, VtValue( true ) } } );
 		}
 
-		// Relationship to the skeleton
-		SdfPath pathToSkeleton( "/ROOT" );
-		pathToSkeleton = pathToSkeleton.AppendChild( TfToken( remedy::cleanName( fbxNode->GetName() ) ) );
-		if( !context.GetPrimAtPath( pathToSkeleton ).has_value() )
+		// Joints are sampled together with the rest of the scene, one frame at a time
+		context.GetAnimationSampler().AddChannel(
+			[ samples, sampleJoints ]( FbxTime time, UsdTimeCode timeCode )
+			{
+				VtVec3fArray skeletonTranslations;
+				VtQuatfArray skeletonRotations;
+				sampleJoints( time, skeletonTranslations, skeletonRotations );
+
+				if( samples->quantizedAnimation )
+				{
+					samples->quantizedAnimation->AddFrame( timeCode.GetValue(), skeletonTranslations, skeletonRotations );
+				}
+				else
+				{
+					samples->translations.push_back( { timeCode, VtValue( skeletonTranslations ) } );
+					samples->rotations.push_back( { timeCode, VtValue( skeletonRotations ) } );
+				}
+				++samples->numFrames;
+
+				for( auto& [ propName, prop ] : samples->propertiesMap )
+				{
+					for( auto& sampler : prop.samplers )
+					{
+						prop.timeSamples[ timeCode ].push_back( sampler( time ) );
+					}
+				}
+			},
+			[ samples, &translationsProp, &rotationsProp, userProperties ]()
+			{
+				if( samples->numFrames == 0 )
+				{
+					return;
+				}
+
+				if( samples->quantizedAnimation )
+				{
+					samples->quantizedAnimation->Finalize();
+					translationsProp.timeSampleSource = std::make_shared< remedy::QuantizedSkelAnimationSamples >(
+						samples->quantizedAnimation,
+						remedy::QuantizedSkelAnimationSamples::Channel::Translations );
+					rotationsProp.timeSampleSource = std::make_shared< remedy::QuantizedSkelAnimationSamples >(
+						samples->quantizedAnimation,
+						remedy::QuantizedSkelAnimationSamples::Channel::Rotations );
+				}
+				else
+				{
+					translationsProp.timeSamples = std::move( samples->translations );
+					rotationsProp.timeSamples = std::move( samples->rotations );
+				}
+
+				for( auto& [ usdProp, prop ] : userProperties )
+				{
+					usdProp->timeSamples
+						= std::vector< std::tuple< UsdTimeCode, VtValue > >( prop->timeSamples.begin(), prop->timeSamples.end() );
+				}
+			} );
+	}
+
+	/// Returns the prototype shared by every copy of the Skeleton prim at \p skeletonPath, creating it on first use.
+	/// The skeleton hands its joints and rest pose over to the prototype and references it like its copies do.
+	SdfPath getOrCreateSkeletonPrototype( remedy::FbxNodeReaderContext& context, const SdfPath& skeletonPath )
+	{
+		const auto existingSkeletonPrim = context.GetPrimAtPath( skeletonPath );
+		if( existingSkeletonPrim && !( *existingSkeletonPrim )->prototype.IsEmpty() )
 		{
-			TF_WARN(
-				"Unable to find a skeleton at path <%s>! SkelAnimation <%s> will remain unbound!\n",
-				pathToSkeleton.GetText(),
-				skelAnimPrimPath.GetText() );
-			return;
+			return ( *existingSkeletonPrim )->prototype;
 		}
-		context.CreateRelationship(
-			pathToSkeleton.AppendProperty( UsdSkelTokens->skelAnimationSource ),
-			skelAnimPrimPath,
-			{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->skelanimation ) } );
+
+		const SdfPath prototypePath = getPrototypePath( context, TfToken( "SKELETONS" ), skeletonPath );
+		remedy::FbxNodeReaderContext::Prim& prototypePrim = getOrAddChildPrim( context, prototypePath );
+		prototypePrim.typeName = UsdFbxPrimTypeNames->Skeleton;
+		remedy::FbxNodeReaderContext::Prim& skeletonPrim = context.AddPrim( skeletonPath );
+		for( const TfToken& name : { UsdSkelTokens->joints, UsdSkelTokens->restTransforms, UsdSkelTokens->bindTransforms } )
+		{
+			auto property = skeletonPrim.propertiesCache.extract( skeletonPath.AppendProperty( name ) );
+			if( !property.empty() )
+			{
+				property.key() = prototypePath.AppendProperty( name );
+				prototypePrim.propertiesCache.insert( std::move( property ) );
+			}
+		}
+		skeletonPrim.prototype = prototypePath;
+		return prototypePath;
 	}
 
 	void readSkeleton( remedy::FbxNodeReaderContext& context )
@@ -2008,10 +2923,6 @@ namespace
 			return;
 		}
 
-		const auto pSkeleton = static_cast< const FbxSkeleton* >( fbxNode->GetNodeAttribute() );
-
-		const TfToken skeletonPrimName( remedy::cleanName( fbxNode->GetName() ) );
-
 		// Skip any child skeletons, they are handled when the first joint is
 		// encountered
 		if( parent && isSkeleton( parent ) )
@@ -2019,61 +2930,69 @@ namespace
 			return;
 		}
 
-		const auto parentPath = context.GetPath().GetParentPath();
-		const auto skeletonPrimPath = parentPath.AppendChild( skeletonPrimName );
+		const remedy::FbxSkeletonTable::Skeleton& skeleton = context.GetSkeletons().GetSkeleton( fbxNode );
+		const SdfPath& skeletonPrimPath = skeleton.primPath;
 
-		if( auto parentPrim = context.GetPrimAtPath( parentPath ) )
-		{
-			parentPrim.value()->children.push_back( skeletonPrimName );
-		}
-		else
-		{
-			TF_WARN( "readSkeleton: Unable to find a parent at path @%s@", parentPath.GetAsString().c_str() );
-		}
-
-		auto& skeletonPrim = context.AddPrim( skeletonPrimPath );
+		// Meshes bound to the Skeleton may have added it already
+		auto& skeletonPrim = getOrAddChildPrim( context, skeletonPrimPath );
 		skeletonPrim.typeName = UsdFbxPrimTypeNames->Skeleton;
 
-		std::vector skeletonHierarchy{ pSkeleton };
-		// Using a fully qualified type so we can call the lambda recursively
-		std::function< void( const FbxSkeleton* ) > collectSkeletonHierarchy = [ & ]( const FbxSkeleton* skeleton )
-		{
-			for( size_t i = 0, n = skeleton->GetNode()->GetChildCount(); i < n; ++i )
+		// Meshes read before the parent of the Skeleton leave their blend shape weights for it to add
+		const auto weightsIt = context.GetBlendShapeWeights().find( skeletonPrimPath );
+		if( weightsIt != context.GetBlendShapeWeights().end() && weightsIt->second->blendShapes == nullptr )
+		{
+			addBlendShapeAnimation( context, skeletonPrimPath, weightsIt->second );
+		}
+
+		const auto scaleFactor = converters::jointScaleFactor( fbxNode->GetScene() );
+		VtMatrix4dArray restTransforms
+			= converters::skeletonToMatrices( context.GetConversion(), skeleton, scaleFactor, converters::Space::Local );
+		VtMatrix4dArray bindTransforms
+			= converters::skeletonToMatrices( context.GetConversion(), skeleton, 1.0, converters::Space::World );
+
+		// Copies of a rig reference a single prototype holding its joints and rest pose, they only carry bind
+		// transforms of their own when they were bound somewhere else
+		const remedy::FbxSkeletonTable::Skeleton& identical
+			= context.GetSkeletons().FindIdentical( skeleton, restTransforms );
+		if( &identical != &skeleton )
+		{
+			const SdfPath prototypePath = getOrCreateSkeletonPrototype( context, identical.primPath );
+			skeletonPrim.prototype = prototypePath;
+			TF_DEBUG( USDFBX_FBX_READERS )
+				.Msg(
+					"UsdFbx::FbxReaders - <%s> is a copy of <%s>, sharing <%s>\n",
+					skeletonPrimPath.GetText(),
+					identical.primPath.GetText(),
+					prototypePath.GetText() );
+
+			const auto sharedBindTransforms
+				= context.GetDataReader().GetProperty( prototypePath.AppendProperty( UsdSkelTokens->bindTransforms ) );
+			if( sharedBindTransforms && sharedBindTransforms.value()->value == VtValue( bindTransforms ) )
 			{
-				const FbxNode* child = skeleton->GetNode()->GetChild( static_cast< int >( i ) );
-				if( !isSkeleton( child ) )
-				{
-					TF_WARN(
-						"\"%s\" is not an FbxSkeleton node, but is part of a "
-						"skeleton hierarchy! It and its children will be ignored",
-						child->GetName() );
-					continue;
-				}
-
-				const FbxSkeleton* childSkeleton = static_cast< const FbxSkeleton* >( child->GetNodeAttribute() );
-				skeletonHierarchy.push_back( childSkeleton );
-				collectSkeletonHierarchy( childSkeleton );
+				return;
 			}
-		};
-		collectSkeletonHierarchy( pSkeleton );
-
-		const auto scaleFactor = fbxNode->GetScene()->GetGlobalSettings().GetSystemUnit().GetConversionFactorFrom(
-			fbxNode->GetScene()->GetGlobalSettings().GetOriginalSystemUnit() );
+			context.CreateUniformProperty(
+				UsdSkelTokens->bindTransforms,
+				SdfValueTypeNames->Matrix4dArray,
+				VtValue( std::move( bindTransforms ) ),
+				{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->skeleton ) } );
+			return;
+		}
 
 		context.CreateUniformProperty(
 			UsdSkelTokens->joints,
 			SdfValueTypeNames->TokenArray,
-			VtValue( converters::skeletonHierarchyToTokenList( skeletonHierarchy ) ),
+			VtValue( skeleton.jointPaths ),
 			{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->skeleton ) } );
 		context.CreateUniformProperty(
 			UsdSkelTokens->restTransforms,
 			SdfValueTypeNames->Matrix4dArray,
-			VtValue( converters::skeletonHierarchyToMatrices( skeletonHierarchy, scaleFactor, converters::Space::Local ) ),
+			VtValue( std::move( restTransforms ) ),
 			{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->skeleton ) } );
 		context.CreateUniformProperty(
 			UsdSkelTokens->bindTransforms,
 			SdfValueTypeNames->Matrix4dArray,
-			VtValue( converters::skeletonHierarchyToMatrices( skeletonHierarchy, 1.0, converters::Space::World ) ),
+			VtValue( std::move( bindTransforms ) ),
 			{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->skeleton ) } );
 	}
 
@@ -2081,77 +3000,177 @@ namespace
 	{
 		TF_DEBUG( USDFBX_FBX_READERS ).Msg( "UsdFbx::FbxReaders - readTransform for \"%s\"\n", context.GetNode()->GetName() );
 		context.GetOrAddPrim().typeName = UsdFbxPrimTypeNames->Xform;
-		// Unfortunately, this has to be done to be compliant with UsdXformCommonAPI,
-		// Otherwise one could write out additional xformOps for pre and post rotation
-		// But doing anything with xformcommonAPI when there's a pre and/or post xform
-		// op in the list will not fly
-		context.GetNode()->ResetPivotSetAndConvertAnimation();
+		FbxNode* node = context.GetNode();
 
-		const TfToken translate = UsdGeomXformOp::GetOpName( UsdGeomXformOp::TypeTranslate );
-		const TfToken pivot = UsdGeomXformOp::GetOpName( UsdGeomXformOp::TypeTranslate, UsdGeomTokens->pivot );
-		const TfToken pivotInv = UsdGeomXformOp::GetOpName( UsdGeomXformOp::TypeTranslate, UsdGeomTokens->pivot, true );
-		const TfToken scale = UsdGeomXformOp::GetOpName( UsdGeomXformOp::TypeScale );
-
-		TfToken rotate;
-		switch( context.GetNode()->RotationOrder.Get() )
+		UsdGeomXformOp::Type rotateType = UsdGeomXformOp::TypeRotateXYZ;
+		switch( node->RotationOrder.Get() )
 		{
 		case FbxEuler::eOrderXYZ:
-			rotate = UsdGeomXformOp::GetOpName( UsdGeomXformOp::TypeRotateXYZ );
+			rotateType = UsdGeomXformOp::TypeRotateXYZ;
 			break;
 		case FbxEuler::eOrderXZY:
-			rotate = UsdGeomXformOp::GetOpName( UsdGeomXformOp::TypeRotateXZY );
+			rotateType = UsdGeomXformOp::TypeRotateXZY;
 			break;
 		case FbxEuler::eOrderYXZ:
-			rotate = UsdGeomXformOp::GetOpName( UsdGeomXformOp::TypeRotateYXZ );
+			rotateType = UsdGeomXformOp::TypeRotateYXZ;
 			break;
 		case FbxEuler::eOrderYZX:
-			rotate = UsdGeomXformOp::GetOpName( UsdGeomXformOp::TypeRotateYZX );
+			rotateType = UsdGeomXformOp::TypeRotateYZX;
 			break;
 		case FbxEuler::eOrderZXY:
-			rotate = UsdGeomXformOp::GetOpName( UsdGeomXformOp::TypeRotateZXY );
+			rotateType = UsdGeomXformOp::TypeRotateZXY;
 			break;
 		case FbxEuler::eOrderZYX:
-			rotate = UsdGeomXformOp::GetOpName( UsdGeomXformOp::TypeRotateZYX );
+			rotateType = UsdGeomXformOp::TypeRotateZYX;
 			break;
 		case FbxEuler::eOrderSphericXYZ:
 		{
 			TF_WARN( "SphericXYZ is not supported! A standard XYZ rotation order will "
 					 "be used instead, this could result in unwanted behavior!" );
-			rotate = UsdGeomXformOp::GetOpName( UsdGeomXformOp::TypeRotateXYZ );
+			rotateType = UsdGeomXformOp::TypeRotateXYZ;
 			break;
 		}
 		}
-		// Scale and rotate pivots are collapsed into a singular translate/inv
-		// translate pivot op Usually the order is [translate, translatePivot, ... ,
-		// !invert!translatePivot] where ... are any of the rotation/scale/etc... ops
-		context.CreateProperty(
-			translate,
-			SdfValueTypeNames->Double3,
-			VtValue( converters::translation( context.GetNode() ) ),
-			&context.GetNode()->LclTranslation );
 
-		context.CreateProperty(
-			pivot,
-			SdfValueTypeNames->Double3,
-			VtValue( converters::rotationPivot( context.GetNode() ) ),
-			&context.GetNode()->RotationPivot );
+		const TfToken translate = UsdGeomXformOp::GetOpName( UsdGeomXformOp::TypeTranslate );
+		const TfToken rotate = UsdGeomXformOp::GetOpName( rotateType );
+		const TfToken scale = UsdGeomXformOp::GetOpName( UsdGeomXformOp::TypeScale );
 
-		context.CreateProperty(
-			rotate,
-			SdfValueTypeNames->Float3,
-			VtValue( converters::rotation( context.GetNode() ) ),
-			&context.GetNode()->LclRotation );
+		std::vector< FbxProperty* > transformProperties{ &node->LclTranslation,
+														 &node->LclRotation,
+														 &node->LclScaling,
+														 &node->RotationOffset,
+														 &node->RotationPivot,
+														 &node->ScalingOffset,
+														 &node->ScalingPivot,
+														 &node->PreRotation,
+														 &node->PostRotation };
+		const remedy::FbxAnimatedChannelIndex& animatedChannels = context.GetAnimatedChannels();
+		const bool isAnimated = std::any_of(
+			transformProperties.cbegin(),
+			transformProperties.cend(),
+			[ & ]( FbxProperty* property ) { return animatedChannels.IsAnimated( *property ); } );
+		if( !isAnimated && context.GetDataReader().GetOptions().collapseStaticXforms )
+		{
+			// Pivots, offsets and pre/post rotations are all part of the evaluated local transform
+			const GfMatrix4d localTransform = converters::localTransform(
+				context.GetConversion(),
+				node,
+				node->EvaluateLocalTransform( FBXSDK_TIME_INFINITE ) );
+			if( GfIsClose( localTransform, GfMatrix4d( 1.0 ), 1e-9 ) )
+			{
+				return;
+			}
 
-		context.CreateProperty(
-			scale,
-			SdfValueTypeNames->Float3,
-			VtValue( converters::scale( context.GetNode() ) ),
-			&context.GetNode()->LclScaling );
+			const TfToken transform = UsdGeomXformOp::GetOpName( UsdGeomXformOp::TypeTransform );
+			context.CreateProperty( transform, SdfValueTypeNames->Matrix4d, VtValue( localTransform ) );
+			context.CreateUniformProperty(
+				UsdGeomTokens->xformOpOrder,
+				SdfValueTypeNames->TokenArray,
+				VtValue( VtTokenArray( { transform } ) ) );
+			return;
+		}
 
+		// Pivots are folded into the translation below, so no pivot ops are needed
 		context.CreateUniformProperty(
 			UsdGeomTokens->xformOpOrder,
 			SdfValueTypeNames->TokenArray,
-			VtValue( VtTokenArray( { translate, pivot, rotate, scale, pivotInv } ) ) );
+			VtValue( VtTokenArray( { translate, rotate, scale } ) ) );
+
+		const remedy::FbxSceneConversion conversion = context.GetConversion();
+		const bool convertsTransform = converters::convertsTransform( conversion, node );
+		if( convertsTransform )
+		{
+			context.CreateProperty(
+				scale,
+				SdfValueTypeNames->Float3,
+				VtValue( converters::scale( conversion, node, converters::scale( node ) ) ),
+				[ conversion ]( FbxNode* fbxNode, FbxTime time )
+				{
+					const FbxDouble3 S = fbxNode->LclScaling.EvaluateValue( time );
+					const GfVec3f lclScaling(
+						static_cast< float >( S[ 0 ] ),
+						static_cast< float >( S[ 1 ] ),
+						static_cast< float >( S[ 2 ] ) );
+					return VtValue( converters::scale( conversion, fbxNode, lclScaling ) );
+				},
+				{ &node->LclScaling } );
+		}
+		else
+		{
+			context.CreateProperty( scale, SdfValueTypeNames->Float3, VtValue( converters::scale( node ) ), &node->LclScaling );
+		}
+
+		if( !helpers::hasPivots( node, context.GetAnimatedChannels() ) )
+		{
+			if( !convertsTransform )
+			{
+				// The common case, the local translation and rotation are used as they are
+				context.CreateProperty(
+					translate,
+					SdfValueTypeNames->Double3,
+					VtValue( converters::translation( node ) ),
+					&node->LclTranslation );
+				context.CreateProperty(
+					rotate,
+					SdfValueTypeNames->Float3,
+					VtValue( converters::rotation( node ) ),
+					&node->LclRotation );
+				return;
+			}
+
+			// Converted transforms are sampled through the evaluator instead of reading the curves as they are
+			context.CreateProperty(
+				translate,
+				SdfValueTypeNames->Double3,
+				VtValue( converters::translation( conversion, node, converters::translation( node ) ) ),
+				[ conversion ]( FbxNode* fbxNode, FbxTime time )
+				{
+					const FbxDouble3 T = fbxNode->LclTranslation.EvaluateValue( time );
+					return VtValue( converters::translation( conversion, fbxNode, GfVec3d( T[ 0 ], T[ 1 ], T[ 2 ] ) ) );
+				},
+				{ &node->LclTranslation } );
+			context.CreateProperty(
+				rotate,
+				SdfValueTypeNames->Float3,
+				VtValue( converters::rotation( conversion, node, converters::rotation( node ) ) ),
+				[ conversion ]( FbxNode* fbxNode, FbxTime time )
+				{
+					const FbxDouble3 R = fbxNode->LclRotation.EvaluateValue( time );
+					const GfVec3f lclRotation(
+						static_cast< float >( R[ 0 ] ),
+						static_cast< float >( R[ 1 ] ),
+						static_cast< float >( R[ 2 ] ) );
+					return VtValue( converters::rotation( conversion, fbxNode, lclRotation ) );
+				},
+				{ &node->LclRotation } );
+			return;
+		}
+
+		// Offsets, pivots and pre/post rotations are folded into the translation and rotation, which keeps the
+		// xformOps compatible with UsdGeomXformCommonAPI without having to rewrite the curves of the node
+		TF_DEBUG( USDFBX_FBX_READERS ).Msg( "UsdFbx::FbxReaders - Folding pivots of \"%s\"\n", node->GetName() );
+		const helpers::FoldedTransform folded = helpers::foldPivots( node, std::nullopt );
+		context.CreateProperty(
+			translate,
+			SdfValueTypeNames->Double3,
+			VtValue( converters::translation( conversion, node, folded.translation ) ),
+			[ conversion ]( FbxNode* fbxNode, FbxTime time )
+			{
+				const GfVec3d translation = helpers::foldPivots( fbxNode, time ).translation;
+				return VtValue( converters::translation( conversion, fbxNode, translation ) );
+			},
+			std::move( transformProperties ) );
+		context.CreateProperty(
+			rotate,
+			SdfValueTypeNames->Float3,
+			VtValue( converters::rotation( conversion, node, folded.rotation ) ),
+			[ conversion ]( FbxNode* fbxNode, FbxTime time )
+			{
+				const GfVec3f rotation = helpers::foldPivots( fbxNode, time ).rotation;
+				return VtValue( converters::rotation( conversion, fbxNode, rotation ) );
+			},
+			{ &node->LclRotation, &node->PreRotation, &node->PostRotation } );
 	}
 } // namespace
 
@@ -2203,15 +3222,11 @@ remedy::FbxNodeReaderContext::FbxNodeReaderContext(
 	UsdFbxDataReader& dataReader,
 	FbxNode* node,
 	SdfPath path,
-	FbxAnimLayer* animLayer,
-	FbxTimeSpan animTimeSpan,
-	double scaleFactor )
+	FbxSceneReaderContext& sceneContext )
 	: m_dataReader( dataReader )
 	, m_fbxNode( node )
 	, m_usdPath( std::move( path ) )
-	, m_fbxAnimLayer( animLayer )
-	, m_fbxTimeSpan( std::move( animTimeSpan ) )
-	, m_scaleFactor( scaleFactor )
+	, m_sceneContext( sceneContext )
 {
 }
 
@@ -2312,7 +3327,13 @@ remedy::FbxNodeReaderContext::Property& remedy::FbxNodeReaderContext::CreateProp
 	prop.variability = variability;
 	if( fbxProperty != nullptr )
 	{
-		prop.timeSamples = helpers::getPropertyAnimation( GetNode(), *fbxProperty, GetAnimLayer(), GetAnimTimeSpan() );
+		if( const auto curveNode = GetAnimatedChannels().GetCurveNode( *fbxProperty ) )
+		{
+			// fbxProperty may point at a temporary, the sampler keeps its own handle
+			GetAnimationSampler().AddChannel(
+				prop,
+				helpers::getPropertySampler( *fbxProperty, curveNode, GetAnimatedChannels().IsLayered() ) );
+		}
 	}
 	prop.value = std::move( defaultValue );
 	return prop;
@@ -2323,6 +3344,7 @@ remedy::FbxNodeReaderContext::Property& remedy::FbxNodeReaderContext::CreateProp
 	const SdfValueTypeName& typeName,
 	VtValue&& defaultValue,
 	std::function< VtValue( FbxNode*, FbxTime ) >&& valueAtTimeFn,
+	std::vector< FbxProperty* >&& sourceProperties,
 	MetadataMap&& metadata,
 	SdfVariability variability )
 {
@@ -2331,6 +3353,7 @@ remedy::FbxNodeReaderContext::Property& remedy::FbxNodeReaderContext::CreateProp
 		typeName,
 		std::move( defaultValue ),
 		std::move( valueAtTimeFn ),
+		std::move( sourceProperties ),
 		std::move( metadata ),
 		variability );
 }
@@ -2340,6 +3363,7 @@ remedy::FbxNodeReaderContext::Property& remedy::FbxNodeReaderContext::CreateProp
 	const SdfValueTypeName& typeName,
 	VtValue&& defaultValue,
 	std::function< VtValue( FbxNode*, FbxTime ) >&& valueAtTimeFn,
+	std::vector< FbxProperty* >&& sourceProperties,
 	MetadataMap&& metadata,
 	SdfVariability variability )
 {
@@ -2347,7 +3371,19 @@ remedy::FbxNodeReaderContext::Property& remedy::FbxNodeReaderContext::CreateProp
 	prop.metadata = std::move( metadata );
 	prop.typeName = typeName;
 	prop.variability = variability;
-	prop.timeSamples = helpers::getPropertyAnimation( GetNode(), valueAtTimeFn, GetAnimLayer(), GetAnimTimeSpan() );
+
+	// The default value says it all unless something the sampler reads is animated
+	const bool isAnimated = std::any_of(
+		sourceProperties.cbegin(),
+		sourceProperties.cend(),
+		[ this ]( FbxProperty* sourceProperty ) { return GetAnimatedChannels().IsAnimated( *sourceProperty ); } );
+	if( isAnimated )
+	{
+		GetAnimationSampler().AddChannel(
+			prop,
+			[ node = GetNode(), valueAtTimeFn = std::move( valueAtTimeFn ) ]( FbxTime time )
+			{ return valueAtTimeFn( node, time ); } );
+	}
 	prop.value = std::move( defaultValue );
 	return prop;
 }
@@ -2398,3 +3434,350 @@ remedy::FbxNodeReaderContext::Property& remedy::FbxNodeReaderContext::CreateConn
 	sourceProperty.hasConnection = true;
 	return sourceProperty;
 }
+
+std::string remedy::GetNodeNamePath( const FbxNode* node )
+{
+	std::string path = node->GetName();
+	for( const FbxNode* parent = node->GetParent(); parent != nullptr && parent->GetParent() != nullptr;
+		 parent = parent->GetParent() )
+	{
+		path = std::string( parent->GetName() ) + "|" + path;
+	}
+	return path;
+}
+
+remedy::FbxSceneConversion remedy::GetSceneConversion( const FbxScene* scene )
+{
+	FbxSceneConversion conversion;
+	const FbxGlobalSettings& settings = scene->GetGlobalSettings();
+	if( settings.GetAxisSystem() != FbxAxisSystem::MayaYUp )
+	{
+		conversion.axis = converters::axisConversion( settings.GetAxisSystem() );
+		conversion.inverseAxis = conversion.axis.GetInverse();
+	}
+	conversion.scaleFactor = FbxSystemUnit::cm.GetConversionFactorFrom( settings.GetSystemUnit() );
+	return conversion;
+}
+
+std::map< std::string, VtVec3fArray > remedy::ReadMeshPoints( FbxScene* scene )
+{
+	TRACE_FUNCTION()
+
+	const FbxSceneConversion conversion = GetSceneConversion( scene );
+	std::map< std::string, VtVec3fArray > points;
+	for( int nodeIndex = 0; nodeIndex < scene->GetNodeCount(); ++nodeIndex )
+	{
+		const FbxNode* node = scene->GetNode( nodeIndex );
+		if( node != nullptr && node->GetNodeAttribute() != nullptr
+			&& node->GetNodeAttribute()->GetAttributeType() == FbxNodeAttribute::eMesh )
+		{
+			points.emplace( GetNodeNamePath( node ), converters::meshPoints( conversion, node ) );
+		}
+	}
+	return points;
+}
+
+SdfPath remedy::GetOrAddMeshPrototype( FbxNodeReaderContext& context )
+{
+	const FbxNode* fbxNode = context.GetNode();
+	auto& prototypes = context.GetMeshPrototypes()[ static_cast< const FbxMesh* >( fbxNode->GetNodeAttribute() ) ];
+	const auto prototypeIt = std::find_if(
+		prototypes.cbegin(),
+		prototypes.cend(),
+		[ & ]( const auto& prototype ) { return isSameMeshConversion( prototype.first, fbxNode ); } );
+	if( prototypeIt != prototypes.cend() )
+	{
+		return prototypeIt->second;
+	}
+
+	const SdfPath prototypePath = getPrototypePath( context, TfToken( "MESHES" ), context.GetPath() );
+	getOrAddChildPrim( context, prototypePath );
+	FbxNodeReaderContext prototypeContext = context.WithPath( prototypePath );
+	readMeshGeometry( prototypeContext );
+	prototypes.emplace_back( fbxNode, prototypePath );
+	return prototypePath;
+}
+
+bool remedy::IsPointInstance( FbxNode* node, const UsdFbxDataReader::Options& options, FbxSceneReaderContext& sceneContext )
+{
+	const FbxNodeAttribute* attribute = node->GetNodeAttribute();
+	if( attribute == nullptr || attribute->GetAttributeType() != FbxNodeAttribute::eMesh || node->GetChildCount() > 0
+		|| !isSharedMesh( node, options ) )
+	{
+		return false;
+	}
+
+	// The instancer only carries a static transform per instance, anything else the node would convert to is lost
+	return !sceneContext.animatedChannels.IsAnimated( node )
+		   && converters::imageableVisibility( node, FBXSDK_TIME_INFINITE ) == UsdGeomTokens->inherited
+		   && sceneContext.GetPropertyIndex( node ).GetUserProperties().empty();
+}
+
+void remedy::ReadPointInstancer( FbxNodeReaderContext& context, const std::vector< FbxNode* >& nodes )
+{
+	TRACE_FUNCTION()
+
+	FbxNodeReaderContext::Prim& instancerPrim = getOrAddChildPrim( context, context.GetPath() );
+	instancerPrim.typeName = UsdFbxPrimTypeNames->PointInstancer;
+	const SdfPath prototypesPath = context.GetPath().AppendChild( TfToken( "Prototypes" ) );
+	getOrAddChildPrim( context, prototypesPath ).typeName = UsdFbxPrimTypeNames->Scope;
+
+	// Every instance in one pass, the prototypes are the shared mesh prototypes the nodes would have referenced
+	std::vector< SdfPath > prototypePaths;
+	std::vector< SdfPath > meshPrototypePaths;
+	VtIntArray protoIndices( nodes.size() );
+	VtVec3fArray positions( nodes.size() );
+	VtQuathArray orientations( nodes.size() );
+	VtVec3fArray scales( nodes.size() );
+	for( size_t instance = 0; instance < nodes.size(); ++instance )
+	{
+		FbxNode* node = nodes[ instance ];
+		const SdfPath nodePath = context.GetPath().GetParentPath().AppendChild( TfToken( remedy::cleanName( node->GetName() ) ) );
+		FbxNodeReaderContext meshContext = context.ForNode( node, nodePath );
+		const SdfPath meshPrototypePath = GetOrAddMeshPrototype( meshContext );
+		const auto prototypeIt = std::find( meshPrototypePaths.cbegin(), meshPrototypePaths.cend(), meshPrototypePath );
+		protoIndices[ instance ] = static_cast< int >( std::distance( meshPrototypePaths.cbegin(), prototypeIt ) );
+		if( prototypeIt == meshPrototypePaths.cend() )
+		{
+			const SdfPath prototypePath = prototypesPath.AppendChild( meshPrototypePath.GetNameToken() );
+			FbxNodeReaderContext::Prim& prototypePrim = getOrAddChildPrim( context, prototypePath );
+			prototypePrim.typeName = UsdFbxPrimTypeNames->Mesh;
+			prototypePrim.prototype = meshPrototypePath;
+			prototypePrim.metadata[ SdfFieldKeys->Instanceable ] = VtValue( true );
+			prototypePaths.push_back( prototypePath );
+			meshPrototypePaths.push_back( meshPrototypePath );
+		}
+
+		// Pivots, offsets and pre/post rotations are all part of the evaluated local transform
+		const FbxAMatrix localTransform = helpers::toFbxAMatrix( converters::localTransform(
+			context.GetConversion(),
+			node,
+			node->EvaluateLocalTransform( FBXSDK_TIME_INFINITE ) ) );
+		const FbxVector4 translation = localTransform.GetT();
+		const FbxQuaternion rotation = localTransform.GetQ();
+		const FbxVector4 scale = localTransform.GetS();
+		positions[ instance ] = GfVec3f( translation[ 0 ], translation[ 1 ], translation[ 2 ] );
+		orientations[ instance ] = GfQuath( GfQuatd( rotation[ 3 ], rotation[ 0 ], rotation[ 1 ], rotation[ 2 ] ) );
+		scales[ instance ] = GfVec3f( scale[ 0 ], scale[ 1 ], scale[ 2 ] );
+	}
+
+	context.CreateProperty(
+		UsdGeomTokens->protoIndices,
+		SdfValueTypeNames->IntArray,
+		VtValue( std::move( protoIndices ) ),
+		{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->geometry ) } );
+	context.CreateProperty(
+		UsdGeomTokens->positions,
+		SdfValueTypeNames->Point3fArray,
+		VtValue( std::move( positions ) ),
+		{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->geometry ) } );
+	context.CreateProperty(
+		UsdGeomTokens->orientations,
+		SdfValueTypeNames->QuathArray,
+		VtValue( std::move( orientations ) ),
+		{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->geometry ) } );
+	context.CreateProperty(
+		UsdGeomTokens->scales,
+		SdfValueTypeNames->Float3Array,
+		VtValue( std::move( scales ) ),
+		{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->geometry ) } );
+	FbxNodeReaderContext::Property& prototypes = context.CreateRelationship( UsdGeomTokens->prototypes, prototypePaths.front() );
+	prototypes.targetPaths.assign( prototypePaths.begin(), prototypePaths.end() );
+
+	TF_DEBUG( USDFBX_FBX_READERS )
+		.Msg(
+			"UsdFbx::FbxReaders - <%s> instances %zu nodes from %zu prototypes\n",
+			context.GetPath().GetText(),
+			nodes.size(),
+			prototypePaths.size() );
+}
+
+bool remedy::IsMergeableMesh( FbxNode* node, const UsdFbxDataReader::Options& options, FbxSceneReaderContext& sceneContext )
+{
+	const FbxNodeAttribute* attribute = node->GetNodeAttribute();
+	if( attribute == nullptr || attribute->GetAttributeType() != FbxNodeAttribute::eMesh || options.sequence
+		|| static_cast< const FbxMesh* >( attribute )->GetDeformerCount() > 0 || helpers::hasVertexColors( node )
+		|| !sceneContext.GetPropertyIndex( node ).GetUserProperties().empty() )
+	{
+		return false;
+	}
+
+	// Everything above the node ends up baked into the points
+	for( FbxNode* ancestor = node; ancestor->GetParent() != nullptr; ancestor = ancestor->GetParent() )
+	{
+		if( sceneContext.animatedChannels.IsAnimated( ancestor )
+			|| converters::imageableVisibility( ancestor, FBXSDK_TIME_INFINITE ) != UsdGeomTokens->inherited )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void remedy::ReadMergedMesh( FbxNodeReaderContext& context, const std::vector< FbxNode* >& nodes )
+{
+	TRACE_FUNCTION()
+
+	getOrAddChildPrim( context, context.GetPath() ).typeName = UsdFbxPrimTypeNames->Mesh;
+
+	VtVec3fArray points;
+	VtVec3fArray normals;
+	bool hasNormals = true;
+	VtIntArray faceVertexCounts;
+	VtIntArray faceVertexIndices;
+	std::map< TfToken, VtVec2fArray > textureCoordinates;
+	std::map< TfToken, TfToken > fbxUvToUsdStNamesMap;
+	std::map< int, VtIntArray > faceSets;
+	for( FbxNode* node : nodes )
+	{
+		const auto* mesh = static_cast< const FbxMesh* >( node->GetNodeAttribute() );
+		const int pointOffset = static_cast< int >( points.size() );
+		const int faceOffset = static_cast< int >( faceVertexCounts.size() );
+		const size_t faceVertexOffset = faceVertexIndices.size();
+
+		// Points already include the geometric transform, normals still need it
+		const FbxSceneConversion& conversion = context.GetConversion();
+		const GfMatrix4d nodeToWorld
+			= converters::globalTransform( conversion, node->EvaluateGlobalTransform( FBXSDK_TIME_INFINITE ) );
+		const GfMatrix4d geometryToNode
+			= conversion.inverseAxis * helpers::toGfMatrix( converters::geometryToNodeTransform( node ) ) * conversion.axis;
+		const GfMatrix4d normalToWorld = ( geometryToNode * nodeToWorld ).GetInverse().GetTranspose();
+		for( const GfVec3f& point : converters::meshPoints( conversion, node ) )
+		{
+			points.push_back( nodeToWorld.Transform( point ) );
+		}
+
+		for( const int count : converters::meshFaceVertexCounts( node ) )
+		{
+			faceVertexCounts.push_back( count );
+		}
+		for( const int index : converters::meshFaceVertexIndices( node ) )
+		{
+			faceVertexIndices.push_back( pointOffset + index );
+		}
+
+		// Merged normals are only authored when every mesh has them
+		const VtVec3fArray meshNormals = converters::meshNormals( conversion, node );
+		hasNormals = hasNormals && meshNormals.size() == faceVertexIndices.size() - faceVertexOffset;
+		if( hasNormals )
+		{
+			for( const GfVec3f& normal : meshNormals )
+			{
+				normals.push_back( normalToWorld.TransformDir( normal ).GetNormalized() );
+			}
+		}
+
+		// Texture coordinate sets missing on some of the meshes are zero on their faces
+		for( auto& [ fbxUvName, usdUvData ] : getMeshTextureCoordinates( node ) )
+		{
+			fbxUvToUsdStNamesMap.emplace( fbxUvName, usdUvData.first );
+			VtVec2fArray& coordinates = textureCoordinates[ usdUvData.first ];
+			coordinates.resize( faceVertexOffset, GfVec2f( 0.0f ) );
+			coordinates.insert( coordinates.end(), usdUvData.second.cbegin(), usdUvData.second.cend() );
+		}
+		for( auto& [ name, coordinates ] : textureCoordinates )
+		{
+			coordinates.resize( faceVertexIndices.size(), GfVec2f( 0.0f ) );
+		}
+
+		// Material of every polygon, the subsets index the merged faces
+		const FbxGeometryElementMaterial* materialElement = mesh->GetElementMaterial();
+		const int numMaterialIndices = materialElement ? materialElement->GetIndexArray().GetCount() : 0;
+		const bool isByPolygon = materialElement && materialElement->GetMappingMode() == FbxLayerElement::eByPolygon;
+		for( int polygon = 0; polygon < mesh->GetPolygonCount(); ++polygon )
+		{
+			int material = 0;
+			if( numMaterialIndices > 0 )
+			{
+				material = materialElement->GetIndexArray()[ isByPolygon && polygon < numMaterialIndices ? polygon : 0 ];
+			}
+			faceSets[ material ].push_back( faceOffset + polygon );
+		}
+	}
+
+	for( auto& [ name, coordinates ] : textureCoordinates )
+	{
+		context.CreateProperty(
+			TfToken( _PRIVATE_TOKENS->primvarsPrefix.GetString() + name.GetString() ),
+			SdfValueTypeNames->TexCoord2fArray,
+			VtValue( std::move( coordinates ) ),
+			nullptr,
+			{ { UsdGeomTokens->interpolation, VtValue( UsdGeomTokens->faceVarying ) },
+			  helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->geometry ) } );
+	}
+
+	context.CreateProperty(
+		UsdGeomTokens->points,
+		SdfValueTypeNames->Point3fArray,
+		VtValue( std::move( points ) ),
+		{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->geometry ) } );
+	if( hasNormals )
+	{
+		context.CreateProperty(
+			TfToken( _PRIVATE_TOKENS->primvarsPrefix.GetString() + UsdGeomTokens->normals.GetString() ),
+			SdfValueTypeNames->Normal3fArray,
+			VtValue( std::move( normals ) ),
+			{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->geometry ),
+			  { UsdGeomTokens->interpolation, VtValue( UsdGeomTokens->faceVarying ) } } );
+	}
+	context.CreateProperty(
+		UsdGeomTokens->faceVertexCounts,
+		SdfValueTypeNames->IntArray,
+		VtValue( std::move( faceVertexCounts ) ),
+		{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->geometry ) } );
+	context.CreateProperty(
+		UsdGeomTokens->faceVertexIndices,
+		SdfValueTypeNames->IntArray,
+		VtValue( std::move( faceVertexIndices ) ),
+		{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->geometry ) } );
+	context.CreateUniformProperty(
+		UsdGeomTokens->orientation,
+		SdfValueTypeNames->Token,
+		VtValue( UsdGeomTokens->rightHanded ),
+		{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->geometry ) } );
+	context.CreateUniformProperty(
+		UsdGeomTokens->subdivisionScheme,
+		SdfValueTypeNames->Token,
+		VtValue( UsdGeomTokens->none ),
+		{ helpers::getDisplayGroupMetadata( UsdFbxDisplayGroupTokens->geometry ) } );
+
+	// The nodes share their materials, the ones of the first node are bound like readMesh does
+	const std::vector< SdfPath > vecMaterials = getOrCreateUSDMaterials( context, fbxUvToUsdStNamesMap );
+	if( vecMaterials.size() > 1 )
+	{
+		context.CreateUniformProperty(
+			TfToken( "subsetFamily:materialBind:familyType" ),
+			SdfValueTypeNames->Token,
+			VtValue( "partition" ) );
+		addSubGeom( context, faceSets, vecMaterials );
+	}
+	else if( vecMaterials.size() == 1 )
+	{
+		context.CreateRelationship( UsdShadeTokens->materialBinding, vecMaterials[ 0 ] );
+	}
+	if( !vecMaterials.empty() )
+	{
+		context.GetOrAddPrim().metadata.emplace(
+			UsdTokens->apiSchemas,
+			VtValue( SdfTokenListOp::Create( { UsdFbxSchemaTokens->MaterialBindingAPI } ) ) );
+	}
+
+	TF_DEBUG( USDFBX_FBX_READERS )
+		.Msg( "UsdFbx::FbxReaders - Merged %zu static meshes into <%s>\n", nodes.size(), context.GetPath().GetText() );
+}
+
+bool remedy::IsPassThroughNull( FbxNode* node, FbxSceneReaderContext& sceneContext )
+{
+	const FbxNodeAttribute* attribute = node->GetNodeAttribute();
+	if( attribute == nullptr || attribute->GetAttributeType() != FbxNodeAttribute::eNull || node->GetChildCount() == 0
+		|| sceneContext.animatedChannels.IsAnimated( node )
+		|| !node->EvaluateLocalTransform( FBXSDK_TIME_INFINITE ).IsIdentity()
+		|| ( sceneContext.conversion.ConvertsUnits() && converters::isRootLevel( node ) )
+		|| converters::imageableVisibility( node, FBXSDK_TIME_INFINITE ) != UsdGeomTokens->inherited
+		|| !sceneContext.GetPropertyIndex( node ).GetUserProperties().empty() )
+	{
+		return false;
+	}
+	return sceneContext.skeletonAncestors.count( node ) == 0;
+}
+
@@ -2,15 +2,114 @@
 
 #pragma once
 
+#include "FbxAnimatedChannelIndex.h"
+#include "FbxAnimationSampler.h"
+#include "FbxNodePropertyIndex.h"
+#include "FbxSkeletonTable.h"
 #include "UsdFbxDataReader.h"
 
 #include <fbxsdk.h>
+#include <pxr/base/gf/matrix4d.h>
 #include <pxr/usd/sdf/schema.h>
 #include <pxr/usd/usd/attribute.h>
 #include <pxr/usd/usd/schemaBase.h>
 
+#include <set>
+
 namespace remedy
 {
+	/// Blend shape channels driven by a SkelAnimation, in the order of its blendShapes. Every mesh bound to the
+	/// Skeleton of the animation appends its channels, the weights are sampled once all of them have been read.
+	struct FbxBlendShapeWeights
+	{
+		std::vector< FbxBlendShapeChannel* > channels;
+
+		/// Deform percent at which the full target of each channel is reached
+		std::vector< double > fullWeights;
+
+		/// Names of the channels on the SkelAnimation and their weights outside of the take
+		VtTokenArray names;
+		VtFloatArray defaultWeights;
+
+		/// Only set once the SkelAnimation exists, a mesh can be read before the Skeleton it is bound to
+		UsdFbxDataReader::Property* blendShapes = nullptr;
+		UsdFbxDataReader::Property* blendShapeWeights = nullptr;
+	};
+
+	/// Takes the axis system and units of a scene into Y-up centimeters, which is what USD gets from every scene. The
+	/// FBX scene is left as it is, the readers convert what they read from it.
+	struct FbxSceneConversion
+	{
+		/// Change of basis from the axis system of the scene into Y-up, in the Gf row vector convention
+		GfMatrix4d axis = GfMatrix4d( 1.0 );
+		GfMatrix4d inverseAxis = GfMatrix4d( 1.0 );
+
+		/// Scale from the units of the scene into centimeters. Like FbxSystemUnit::ConvertScene, it is applied to the
+		/// nodes right below the root and scales everything below them.
+		double scaleFactor = 1.0;
+
+		[[nodiscard]] bool ConvertsAxis() const
+		{
+			return axis != GfMatrix4d( 1.0 );
+		}
+
+		[[nodiscard]] bool ConvertsUnits() const
+		{
+			return scaleFactor != 1.0;
+		}
+	};
+
+	/// Returns the conversion of \p scene into Y-up centimeters
+	FbxSceneConversion GetSceneConversion( const FbxScene* scene );
+
+	/// State shared by the readers of every node in the scene
+	struct FbxSceneReaderContext
+	{
+		FbxAnimLayer* animLayer = nullptr;
+		FbxTimeSpan animTimeSpan;
+		FbxSceneConversion conversion;
+
+		/// Every property with curves on any layer of the anim stack
+		FbxAnimatedChannelIndex animatedChannels;
+
+		/// Animated properties register their channels here, they are sampled once the whole scene has been read
+		FbxAnimationSampler animationSampler;
+
+		/// Joint topology shared by skeletons, skeletal animation and skin bindings
+		FbxSkeletonTable skeletons;
+
+		/// Blend shape weights by the path of the Skeleton they are bound through
+		std::map< SdfPath, std::shared_ptr< FbxBlendShapeWeights > > blendShapeWeights;
+
+		/// Points of every mesh by the name path of its node, only filled when the file is read as a sequence. Name
+		/// paths shared by several meshes map to nullptr, they cannot be told apart in the other files.
+		std::map< std::string, UsdFbxDataReader::Property* > sequencePoints;
+
+		/// Prototypes converted from meshes shared by several nodes, with the node each one was converted from
+		std::map< const FbxMesh*, std::vector< std::pair< const FbxNode*, SdfPath > > > meshPrototypes;
+
+		/// Static mesh nodes to merge by the names of their materials, in the order they were found
+		std::vector< std::pair< std::vector< std::string >, std::vector< FbxNode* > > > mergedMeshes;
+
+		/// Every node with a skeleton below it, the paths of skeletons follow the node hierarchy through them
+		std::set< const FbxNode* > skeletonAncestors;
+
+		/// User properties by node, collected on first use. Shared by the checks made while nodes are collected and
+		/// the readers of the nodes.
+		std::map< const FbxNode*, FbxNodePropertyIndex > propertyIndices;
+
+		/// Returns the user properties of \p node, collecting them on first use
+		[[nodiscard]] const FbxNodePropertyIndex& GetPropertyIndex( const FbxNode* node )
+		{
+			auto it = propertyIndices.find( node );
+			if( it == propertyIndices.end() )
+			{
+				it = propertyIndices.emplace( node, FbxNodePropertyIndex( node, animatedChannels ) ).first;
+			}
+			return it->second;
+		}
+	};
+
 	class FbxNodeReaderContext
 	{
 	public:
@@ -21,13 +120,16 @@ namespace remedy
 			UsdFbxDataReader& dataReader,
 			FbxNode* node,
 			SdfPath path,
-			FbxAnimLayer* animLayer,
-			FbxTimeSpan animTimeSpan,
-			double scaleFactor );
+			FbxSceneReaderContext& sceneContext );
 
 		[[nodiscard]] double GetScaleFactor() const
 		{
-			return m_scaleFactor;
+			return m_sceneContext.conversion.scaleFactor;
+		}
+
+		[[nodiscard]] const FbxSceneConversion& GetConversion() const
+		{
+			return m_sceneContext.conversion;
 		}
 
 		/// Returns the prim object.
@@ -43,22 +145,69 @@ namespace remedy
 
 		[[nodiscard]] FbxAnimLayer* GetAnimLayer()
 		{
-			return m_fbxAnimLayer;
+			return m_sceneContext.animLayer;
 		}
 
 		[[nodiscard]] const FbxAnimLayer* GetAnimLayer() const
 		{
-			return m_fbxAnimLayer;
+			return m_sceneContext.animLayer;
 		}
 
 		[[nodiscard]] FbxTimeSpan& GetAnimTimeSpan()
 		{
-			return m_fbxTimeSpan;
+			return m_sceneContext.animTimeSpan;
 		}
 
 		[[nodiscard]] const FbxTimeSpan& GetAnimTimeSpan() const
 		{
-			return m_fbxTimeSpan;
+			return m_sceneContext.animTimeSpan;
+		}
+
+		[[nodiscard]] FbxAnimatedChannelIndex& GetAnimatedChannels()
+		{
+			return m_sceneContext.animatedChannels;
+		}
+
+		[[nodiscard]] const FbxAnimatedChannelIndex& GetAnimatedChannels() const
+		{
+			return m_sceneContext.animatedChannels;
+		}
+
+		/// Returns the user properties of the node, collected on first use
+		[[nodiscard]] const FbxNodePropertyIndex& GetPropertyIndex()
+		{
+			return m_sceneContext.GetPropertyIndex( m_fbxNode );
+		}
+
+		/// Returns the user properties of another node of the scene, such as the joints of a skeleton
+		[[nodiscard]] const FbxNodePropertyIndex& GetPropertyIndex( const FbxNode* node )
+		{
+			return m_sceneContext.GetPropertyIndex( node );
+		}
+
+		[[nodiscard]] FbxAnimationSampler& GetAnimationSampler()
+		{
+			return m_sceneContext.animationSampler;
+		}
+
+		[[nodiscard]] FbxSkeletonTable& GetSkeletons()
+		{
+			return m_sceneContext.skeletons;
+		}
+
+		[[nodiscard]] std::map< SdfPath, std::shared_ptr< FbxBlendShapeWeights > >& GetBlendShapeWeights()
+		{
+			return m_sceneContext.blendShapeWeights;
+		}
+
+		[[nodiscard]] std::map< std::string, Property* >& GetSequencePoints()
+		{
+			return m_sceneContext.sequencePoints;
+		}
+
+		[[nodiscard]] std::map< const FbxMesh*, std::vector< std::pair< const FbxNode*, SdfPath > > >& GetMeshPrototypes()
+		{
+			return m_sceneContext.meshPrototypes;
 		}
 
 		/// Returns the Usd path to this prim.
@@ -67,6 +216,18 @@ namespace remedy
 			return m_usdPath;
 		}
 
+		/// Returns a context reading the same node into the prim at \p path
+		[[nodiscard]] FbxNodeReaderContext WithPath( SdfPath path )
+		{
+			return FbxNodeReaderContext( m_dataReader, m_fbxNode, std::move( path ), m_sceneContext );
+		}
+
+		/// Returns a context reading \p node of the same scene into the prim at \p path
+		[[nodiscard]] FbxNodeReaderContext ForNode( FbxNode* node, SdfPath path )
+		{
+			return FbxNodeReaderContext( m_dataReader, node, std::move( path ), m_sceneContext );
+		}
+
 		[[nodiscard]] Prim& GetOrAddPrim()
 		{
 			if( const auto maybePrim = GetPrimAtPath( m_usdPath ) )
@@ -106,11 +267,15 @@ namespace remedy
 			return m_dataReader;
 		}
 
+		/// \p valueAtTimeFn is only sampled over the anim time span when one of \p sourceProperties,
+		/// the FbxProperties it reads, is animated. Otherwise the property only gets \p defaultValue.
+		/// Sampling is deferred to the animation sampler, the time samples are filled in once the scene has been read.
 		Property& CreateProperty(
 			const SdfPath& propertyPath,
 			const SdfValueTypeName& typeName,
 			VtValue&& defaultValue,
 			std::function< VtValue( FbxNode*, FbxTime ) >&& valueAtTimeFn,
+			std::vector< FbxProperty* >&& sourceProperties,
 			MetadataMap&& metadata = {},
 			SdfVariability variability = SdfVariabilityVarying );
 
@@ -119,6 +284,7 @@ namespace remedy
 			const SdfValueTypeName& typeName,
 			VtValue&& defaultValue,
 			std::function< VtValue( FbxNode*, FbxTime ) >&& valueAtTimeFn,
+			std::vector< FbxProperty* >&& sourceProperties,
 			MetadataMap&& metadata = {},
 			SdfVariability variability = SdfVariabilityVarying );
 
@@ -182,13 +348,41 @@ namespace remedy
 		UsdFbxDataReader& m_dataReader;
 		FbxNode* m_fbxNode;
 		SdfPath m_usdPath;
-		FbxAnimLayer* m_fbxAnimLayer;
-		FbxTimeSpan m_fbxTimeSpan;
-		double m_scaleFactor;
+		FbxSceneReaderContext& m_sceneContext;
 	};
 
 	using NodeReaderFn = std::function< void( FbxNodeReaderContext& ) >;
 
+	/// Names of \p node and its ancestors below the root node, separated by '|'. Identifies the same node in every
+	/// file of a sequence, where the prim paths of the first file are not known.
+	std::string GetNodeNamePath( const FbxNode* node );
+
+	/// Points of every mesh in \p scene by the name path of its node, as readMesh writes them
+	std::map< std::string, VtVec3fArray > ReadMeshPoints( FbxScene* scene );
+
+	/// Returns the prototype the mesh of the node of \p context is converted into, converting it on first use.
+	/// Only meant for meshes shared by several nodes.
+	SdfPath GetOrAddMeshPrototype( FbxNodeReaderContext& context );
+
+	/// Nodes a point instancer can draw: visible, static leaf nodes sharing an undeformed mesh, without user properties
+	bool IsPointInstance( FbxNode* node, const UsdFbxDataReader::Options& options, FbxSceneReaderContext& sceneContext );
+
+	/// Writes \p nodes as the instances of a UsdGeomPointInstancer at the path of \p context, with a prototype per mesh
+	void ReadPointInstancer( FbxNodeReaderContext& context, const std::vector< FbxNode* >& nodes );
+
+	/// Nodes whose mesh can be merged into others: undeformed, without vertex colors or user properties, and neither
+	/// animated nor hidden themselves or through any of their ancestors
+	bool IsMergeableMesh( FbxNode* node, const UsdFbxDataReader::Options& options, FbxSceneReaderContext& sceneContext );
+
+	/// Writes the meshes of \p nodes as a single mesh in world space at the path of \p context. The nodes share
+	/// their materials, one GeomSubset is added per material when there are several.
+	void ReadMergedMesh( FbxNodeReaderContext& context, const std::vector< FbxNode* >& nodes );
+
+	/// Nulls that only group their children: an identity local transform that is not animated, visible and without
+	/// user properties. Empty nulls are kept as locators, and nulls above skeletons as well since skeleton paths
+	/// follow the node hierarchy.
+	bool IsPassThroughNull( FbxNode* node, FbxSceneReaderContext& sceneContext );
+
 	class FbxNodeReaders
 	{
 	public:
@@ -0,0 +1,146 @@
+// Copyright (C) Remedy Entertainment Plc.
+
+#include "FbxSkeletonTable.h"
+
+#include "DebugCodes.h"
+#include "Helpers.h"
+#include "PrecompiledHeader.h"
+
+DIAGNOSTIC_PUSH
+IGNORE_USD_WARNINGS
+#include <pxr/base/tf/hash.h>
+#include <pxr/base/trace/trace.h>
+DIAGNOSTIC_POP
+
+#include <set>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace
+{
+	bool isJoint( const FbxNode* node )
+	{
+		return node != nullptr && node->GetNodeAttribute() && node->GetNodeAttributeCount() > 0
+			   && node->GetNodeAttribute()->GetAttributeType() == FbxNodeAttribute::eSkeleton;
+	}
+
+	// Mirrors the prim names given out by collectFbxNodes
+	TfToken primName( const FbxNode* node )
+	{
+		std::set< std::string > usedNames;
+		for( int i = 0, n = node->GetChildCount(); i != n; ++i )
+		{
+			usedNames.insert( node->GetChild( i )->GetName() );
+		}
+		return TfToken( remedy::cleanName( node->GetName(), usedNames ) );
+	}
+} // namespace
+
+remedy::FbxSkeletonTable::FbxSkeletonTable( const SdfPath& rootPath )
+	: m_rootPath( rootPath )
+{
+}
+
+const remedy::FbxSkeletonTable::Skeleton& remedy::FbxSkeletonTable::GetSkeleton( const FbxNode* joint )
+{
+	const auto it = m_skeletonsByJoint.find( joint );
+	if( it != m_skeletonsByJoint.end() )
+	{
+		return *it->second;
+	}
+
+	const FbxNode* rootJoint = joint;
+	while( isJoint( rootJoint->GetParent() ) )
+	{
+		rootJoint = rootJoint->GetParent();
+	}
+	return addSkeleton( rootJoint );
+}
+
+const remedy::FbxSkeletonTable::Skeleton& remedy::FbxSkeletonTable::addSkeleton( const FbxNode* rootJoint )
+{
+	TRACE_FUNCTION()
+
+	Skeleton& skeleton = m_skeletons.emplace_back();
+
+	// The Skeleton prim replaces the root joint in the hierarchy read by collectFbxNodes
+	std::vector< TfToken > ancestorNames;
+	const FbxNode* sceneRoot = rootJoint->GetScene()->GetRootNode();
+	for( const FbxNode* ancestor = rootJoint->GetParent(); ancestor && ancestor != sceneRoot;
+		 ancestor = ancestor->GetParent() )
+	{
+		ancestorNames.push_back( primName( ancestor ) );
+	}
+	skeleton.primPath = m_rootPath;
+	for( auto nameIt = ancestorNames.rbegin(); nameIt != ancestorNames.rend(); ++nameIt )
+	{
+		skeleton.primPath = skeleton.primPath.AppendChild( *nameIt );
+	}
+	skeleton.primPath = skeleton.primPath.AppendChild( TfToken( remedy::cleanName( rootJoint->GetName() ) ) );
+
+	// Depth first, so every joint comes after its parent. Joint paths extend the path of their parent, which cleans
+	// every name once instead of once per descendant
+	std::vector< SdfPath > relativePaths;
+	std::vector< std::pair< const FbxNode*, int > > stack{ { rootJoint, -1 } };
+	while( !stack.empty() )
+	{
+		const auto [ node, parent ] = stack.back();
+		stack.pop_back();
+
+		const SdfPath name( remedy::cleanName( node->GetName() ) );
+		relativePaths.push_back( parent < 0 ? name : relativePaths[ parent ].AppendPath( name ) );
+		const int index = static_cast< int >( skeleton.joints.size() );
+		// The evaluator wants mutable nodes, the table itself never modifies them
+		skeleton.joints.push_back( { const_cast< FbxNode* >( node ), relativePaths.back().GetAsToken(), parent } );
+		m_skeletonsByJoint.emplace( node, &skeleton );
+		m_jointIndices.emplace( node, index );
+
+		// Children are pushed in reverse so they are visited in the order of the FBX hierarchy
+		for( int i = node->GetChildCount() - 1; i >= 0; --i )
+		{
+			const FbxNode* child = node->GetChild( i );
+			if( !isJoint( child ) )
+			{
+				TF_WARN(
+					"\"%s\" is not an FbxSkeleton node, but is part of a "
+					"skeleton hierarchy! It and its children will be ignored",
+					child->GetName() );
+				continue;
+			}
+			stack.emplace_back( child, index );
+		}
+	}
+
+	skeleton.jointPaths.reserve( skeleton.joints.size() );
+	for( const Joint& joint : skeleton.joints )
+	{
+		skeleton.jointPaths.push_back( joint.path );
+	}
+
+	TF_DEBUG( USDFBX )
+		.Msg(
+			"UsdFbx - Collected %zu joints of skeleton <%s>\n",
+			skeleton.joints.size(),
+			skeleton.primPath.GetText() );
+	return skeleton;
+}
+
+const remedy::FbxSkeletonTable::Skeleton& remedy::FbxSkeletonTable::FindIdentical(
+	const Skeleton& skeleton,
+	const VtMatrix4dArray& restTransforms )
+{
+	const size_t hash = TfHash::Combine( skeleton.jointPaths, restTransforms );
+	const auto [ begin, end ] = m_restPoses.equal_range( hash );
+	for( auto it = begin; it != end; ++it )
+	{
+		const RestPose& restPose = it->second;
+		if( restPose.skeleton == &skeleton
+			|| ( restPose.skeleton->jointPaths == skeleton.jointPaths && restPose.restTransforms == restTransforms ) )
+		{
+			return *restPose.skeleton;
+		}
+	}
+
+	m_restPoses.emplace( hash, RestPose{ &skeleton, restTransforms } );
+	return skeleton;
+}
@@ -0,0 +1,80 @@
+// Copyright (C) Remedy Entertainment Plc.
+
+#pragma once
+
+#include <fbxsdk.h>
+#include <pxr/pxr.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace remedy
+{
+	/// The joint topology of every skeleton in a scene.
+	///
+	/// Each skeleton is walked once, the first time one of its joints is looked up, and shared by readSkeleton,
+	/// readSkeletonAnimation and the skin bindings of every mesh. Joints are stored in the order UsdSkel expects them,
+	/// parents before their children.
+	class FbxSkeletonTable
+	{
+	public:
+		struct Joint
+		{
+			FbxNode* node;
+			/// Path of the joint relative to the skeleton, as written to the joints attribute
+			TfToken path;
+			/// Index of the parent joint, -1 for the root joint
+			int parent;
+		};
+
+		struct Skeleton
+		{
+			/// Path of the Skeleton prim
+			SdfPath primPath;
+			std::vector< Joint > joints;
+			/// The paths of \c joints, ready to be written to the order dependent joints attribute of UsdSkel
+			VtTokenArray jointPaths;
+		};
+
+		FbxSkeletonTable() = default;
+
+		/// \p rootPath is the path of the prim the children of the FBX root node are read under
+		explicit FbxSkeletonTable( const SdfPath& rootPath );
+
+		/// Returns the skeleton \p joint belongs to, walking it on first use
+		[[nodiscard]] const Skeleton& GetSkeleton( const FbxNode* joint );
+
+		/// Returns the index of \p joint in its skeleton, or -1 when the joint has not been walked yet
+		[[nodiscard]] int GetJointIndex( const FbxNode* joint ) const
+		{
+			const auto it = m_jointIndices.find( joint );
+			return it != m_jointIndices.end() ? it->second : -1;
+		}
+
+		/// Returns the first skeleton found with the same joint paths and rest transforms as \p skeleton. That is
+		/// \p skeleton itself unless it is a copy of a rig read before.
+		[[nodiscard]] const Skeleton& FindIdentical( const Skeleton& skeleton, const VtMatrix4dArray& restTransforms );
+
+	private:
+		const Skeleton& addSkeleton( const FbxNode* rootJoint );
+
+		SdfPath m_rootPath;
+		// A deque keeps references to skeletons valid while new ones are added
+		std::deque< Skeleton > m_skeletons;
+		std::unordered_map< const FbxNode*, const Skeleton* > m_skeletonsByJoint;
+		std::unordered_map< const FbxNode*, int > m_jointIndices;
+
+		struct RestPose
+		{
+			const Skeleton* skeleton;
+			VtMatrix4dArray restTransforms;
+		};
+		std::unordered_multimap< size_t, RestPose > m_restPoses;
+	};
+} // namespace remedy
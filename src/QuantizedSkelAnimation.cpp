@@ -0,0 +1,242 @@
+// Copyright (C) Remedy Entertainment Plc.
+
+#include "QuantizedSkelAnimation.h"
+
+#include "DebugCodes.h"
+#include "PrecompiledHeader.h"
+
+DIAGNOSTIC_PUSH
+IGNORE_USD_WARNINGS
+#include <pxr/base/gf/quatf.h>
+#include <pxr/base/trace/trace.h>
+DIAGNOSTIC_POP
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace
+{
+	// Any quaternion component that is not the largest lies within [-1/sqrt(2), 1/sqrt(2)]
+	constexpr float QUAT_COMPONENT_RANGE = 0.70710678118654752f;
+	constexpr uint16_t QUAT_COMPONENT_MASK = 0x7fff;
+	constexpr uint16_t QUAT_INDEX_BIT = 0x8000;
+	constexpr float TRANSLATION_STEPS = 65535.0f;
+
+	void encodeRotation( const GfQuatf& rotation, uint16_t* out )
+	{
+		const GfQuatf q = rotation.GetNormalized();
+		const float components[ 4 ] = { q.GetImaginary()[ 0 ], q.GetImaginary()[ 1 ], q.GetImaginary()[ 2 ], q.GetReal() };
+
+		int largest = 0;
+		for( int i = 1; i < 4; ++i )
+		{
+			if( std::abs( components[ i ] ) > std::abs( components[ largest ] ) )
+			{
+				largest = i;
+			}
+		}
+
+		// q and -q are the same rotation, flip so the dropped component is always positive
+		const float sign = components[ largest ] < 0.0f ? -1.0f : 1.0f;
+		int outIndex = 0;
+		for( int i = 0; i < 4; ++i )
+		{
+			if( i == largest )
+			{
+				continue;
+			}
+			const float value = std::clamp( components[ i ] * sign, -QUAT_COMPONENT_RANGE, QUAT_COMPONENT_RANGE );
+			const float normalized = ( value + QUAT_COMPONENT_RANGE ) / ( 2.0f * QUAT_COMPONENT_RANGE );
+			out[ outIndex++ ] = static_cast< uint16_t >( std::lround( normalized * QUAT_COMPONENT_MASK ) );
+		}
+
+		if( largest & 2 )
+		{
+			out[ 0 ] |= QUAT_INDEX_BIT;
+		}
+		if( largest & 1 )
+		{
+			out[ 1 ] |= QUAT_INDEX_BIT;
+		}
+	}
+
+	GfQuatf decodeRotation( const uint16_t* in )
+	{
+		const int largest = ( ( in[ 0 ] & QUAT_INDEX_BIT ) ? 2 : 0 ) | ( ( in[ 1 ] & QUAT_INDEX_BIT ) ? 1 : 0 );
+
+		float components[ 4 ] = {};
+		float sumOfSquares = 0.0f;
+		int inIndex = 0;
+		for( int i = 0; i < 4; ++i )
+		{
+			if( i == largest )
+			{
+				continue;
+			}
+			const float normalized = static_cast< float >( in[ inIndex++ ] & QUAT_COMPONENT_MASK ) / QUAT_COMPONENT_MASK;
+			components[ i ] = normalized * 2.0f * QUAT_COMPONENT_RANGE - QUAT_COMPONENT_RANGE;
+			sumOfSquares += components[ i ] * components[ i ];
+		}
+		components[ largest ] = std::sqrt( std::max( 0.0f, 1.0f - sumOfSquares ) );
+
+		return { components[ 3 ], components[ 0 ], components[ 1 ], components[ 2 ] };
+	}
+} // namespace
+
+remedy::QuantizedSkelAnimation::QuantizedSkelAnimation( size_t numJoints )
+	: m_numJoints( numJoints )
+{
+}
+
+void remedy::QuantizedSkelAnimation::AddFrame( double time, const VtVec3fArray& translations, const VtQuatfArray& rotations )
+{
+	if( !TF_VERIFY( translations.size() == m_numJoints && rotations.size() == m_numJoints ) )
+	{
+		return;
+	}
+
+	m_times.push_back( time );
+	m_pendingTranslations.insert( m_pendingTranslations.end(), translations.cbegin(), translations.cend() );
+
+	const size_t offset = m_rotations.size();
+	m_rotations.resize( offset + m_numJoints * 3 );
+	for( size_t joint = 0; joint < m_numJoints; ++joint )
+	{
+		encodeRotation( rotations[ joint ], &m_rotations[ offset + joint * 3 ] );
+	}
+}
+
+void remedy::QuantizedSkelAnimation::Finalize()
+{
+	TRACE_FUNCTION()
+
+	const size_t numFrames = m_times.size();
+	m_translationMin.assign( m_numJoints, GfVec3f( std::numeric_limits< float >::max() ) );
+	m_translationExtent.assign( m_numJoints, GfVec3f( 0.0f ) );
+
+	std::vector< GfVec3f > translationMax( m_numJoints, GfVec3f( std::numeric_limits< float >::lowest() ) );
+	for( size_t frame = 0; frame < numFrames; ++frame )
+	{
+		for( size_t joint = 0; joint < m_numJoints; ++joint )
+		{
+			const GfVec3f& t = m_pendingTranslations[ frame * m_numJoints + joint ];
+			for( size_t axis = 0; axis < 3; ++axis )
+			{
+				m_translationMin[ joint ][ axis ] = std::min( m_translationMin[ joint ][ axis ], t[ axis ] );
+				translationMax[ joint ][ axis ] = std::max( translationMax[ joint ][ axis ], t[ axis ] );
+			}
+		}
+	}
+
+	for( size_t joint = 0; joint < m_numJoints && numFrames > 0; ++joint )
+	{
+		m_translationExtent[ joint ] = translationMax[ joint ] - m_translationMin[ joint ];
+	}
+
+	m_translations.resize( m_pendingTranslations.size() * 3 );
+	for( size_t frame = 0; frame < numFrames; ++frame )
+	{
+		for( size_t joint = 0; joint < m_numJoints; ++joint )
+		{
+			const size_t index = frame * m_numJoints + joint;
+			const GfVec3f& t = m_pendingTranslations[ index ];
+			for( size_t axis = 0; axis < 3; ++axis )
+			{
+				const float extent = m_translationExtent[ joint ][ axis ];
+				const float normalized = extent > 0.0f ? ( t[ axis ] - m_translationMin[ joint ][ axis ] ) / extent : 0.0f;
+				m_translations[ index * 3 + axis ] = static_cast< uint16_t >( std::lround( normalized * TRANSLATION_STEPS ) );
+			}
+		}
+	}
+
+	m_pendingTranslations.clear();
+	m_pendingTranslations.shrink_to_fit();
+
+	TF_DEBUG( USDFBX_PERF )
+		.Msg(
+			"UsdFbx - Quantized SkelAnimation with %zu joints over %zu frames: %zu bytes -> %zu bytes (%.2f:1)\n",
+			m_numJoints,
+			numFrames,
+			GetUncompressedSize(),
+			GetCompressedSize(),
+			GetCompressedSize() > 0 ? static_cast< double >( GetUncompressedSize() ) / GetCompressedSize() : 0.0 );
+}
+
+VtVec3fArray remedy::QuantizedSkelAnimation::DecodeTranslations( size_t frameIndex ) const
+{
+	VtVec3fArray result( m_numJoints );
+	const uint16_t* frameData = m_translations.data() + frameIndex * m_numJoints * 3;
+	for( size_t joint = 0; joint < m_numJoints; ++joint )
+	{
+		for( size_t axis = 0; axis < 3; ++axis )
+		{
+			result[ joint ][ axis ] = m_translationMin[ joint ][ axis ]
+									  + frameData[ joint * 3 + axis ] / TRANSLATION_STEPS * m_translationExtent[ joint ][ axis ];
+		}
+	}
+	return result;
+}
+
+VtQuatfArray remedy::QuantizedSkelAnimation::DecodeRotations( size_t frameIndex ) const
+{
+	VtQuatfArray result( m_numJoints );
+	const uint16_t* frameData = m_rotations.data() + frameIndex * m_numJoints * 3;
+	for( size_t joint = 0; joint < m_numJoints; ++joint )
+	{
+		result[ joint ] = decodeRotation( frameData + joint * 3 );
+	}
+	return result;
+}
+
+size_t remedy::QuantizedSkelAnimation::GetCompressedSize() const
+{
+	return ( m_translations.size() + m_rotations.size() ) * sizeof( uint16_t )
+		   + ( m_translationMin.size() + m_translationExtent.size() ) * sizeof( GfVec3f ) + m_times.size() * sizeof( double );
+}
+
+size_t remedy::QuantizedSkelAnimation::GetUncompressedSize() const
+{
+	return m_times.size() * ( m_numJoints * ( sizeof( GfVec3f ) + sizeof( GfQuatf ) ) + sizeof( double ) );
+}
+
+remedy::QuantizedSkelAnimationSamples::QuantizedSkelAnimationSamples(
+	std::shared_ptr< const QuantizedSkelAnimation > animation,
+	Channel channel )
+	: m_animation( std::move( animation ) )
+	, m_channel( channel )
+	, m_cache( channel == Channel::Translations ? "quantized SkelAnimation translations" : "quantized SkelAnimation rotations" )
+{
+}
+
+const std::vector< double >& remedy::QuantizedSkelAnimationSamples::GetTimes() const
+{
+	return m_animation->GetTimes();
+}
+
+bool remedy::QuantizedSkelAnimationSamples::Get( double time, VtValue* value ) const
+{
+	const auto& times = m_animation->GetTimes();
+	const auto timeIt = std::lower_bound( times.cbegin(), times.cend(), time );
+	if( timeIt == times.cend() || *timeIt != time )
+	{
+		return false;
+	}
+
+	if( value == nullptr )
+	{
+		return true;
+	}
+
+	const auto frameIndex = static_cast< size_t >( std::distance( times.cbegin(), timeIt ) );
+	*value = m_cache.Get(
+		frameIndex,
+		[ this ]( size_t frame )
+		{
+			return m_channel == Channel::Translations ? VtValue( m_animation->DecodeTranslations( frame ) )
+													  : VtValue( m_animation->DecodeRotations( frame ) );
+		} );
+	return true;
+}
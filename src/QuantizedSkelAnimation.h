@@ -0,0 +1,92 @@
+// Copyright (C) Remedy Entertainment Plc.
+
+#pragma once
+
+#include "TimeSampleCache.h"
+#include "UsdFbxDataReader.h"
+
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/pxr.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace remedy
+{
+	/// Compact storage for the translations and rotations of a SkelAnimation.
+	///
+	/// Rotations are stored as "smallest three" quaternions, the largest component is dropped (and
+	/// reconstructed from the unit length constraint) while the remaining three are stored as 15 bit
+	/// integers. The index of the dropped component is spread over the top bits of the first two.
+	/// Translations are quantized to 16 bits per axis within the range each joint moves in over the take.
+	///
+	/// Frames are added in time order through AddFrame, after which Finalize must be called before decoding.
+	class QuantizedSkelAnimation
+	{
+	public:
+		explicit QuantizedSkelAnimation( size_t numJoints );
+
+		void AddFrame( double time, const VtVec3fArray& translations, const VtQuatfArray& rotations );
+		void Finalize();
+
+		[[nodiscard]] VtVec3fArray DecodeTranslations( size_t frameIndex ) const;
+		[[nodiscard]] VtQuatfArray DecodeRotations( size_t frameIndex ) const;
+
+		[[nodiscard]] const std::vector< double >& GetTimes() const
+		{
+			return m_times;
+		}
+
+		[[nodiscard]] size_t GetNumJoints() const
+		{
+			return m_numJoints;
+		}
+
+		/// Size in bytes of the quantized data
+		[[nodiscard]] size_t GetCompressedSize() const;
+
+		/// Size in bytes the same data takes as VtVec3fArray/VtQuatfArray samples
+		[[nodiscard]] size_t GetUncompressedSize() const;
+
+	private:
+		size_t m_numJoints;
+		std::vector< double > m_times;
+
+		// Per joint, per axis range
+		std::vector< GfVec3f > m_translationMin;
+		std::vector< GfVec3f > m_translationExtent;
+
+		// [frame][joint][axis]
+		std::vector< uint16_t > m_translations;
+		std::vector< uint16_t > m_rotations;
+
+		// Only alive between AddFrame and Finalize, the range is not known up front
+		std::vector< GfVec3f > m_pendingTranslations;
+	};
+
+	/// Serves one channel of a QuantizedSkelAnimation as time samples, keeping the last few decoded frames
+	/// around as playback tends to request the same frame for several properties/prims in a row.
+	class QuantizedSkelAnimationSamples : public UsdFbxDataReader::TimeSampleSource
+	{
+	public:
+		enum class Channel
+		{
+			Translations,
+			Rotations
+		};
+
+		QuantizedSkelAnimationSamples( std::shared_ptr< const QuantizedSkelAnimation > animation, Channel channel );
+
+		[[nodiscard]] const std::vector< double >& GetTimes() const override;
+		[[nodiscard]] bool Get( double time, VtValue* value ) const override;
+
+	private:
+		std::shared_ptr< const QuantizedSkelAnimation > m_animation;
+		Channel m_channel;
+		mutable TimeSampleCache< VtValue > m_cache;
+	};
+} // namespace remedy
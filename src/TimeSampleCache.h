@@ -0,0 +1,141 @@
+// Copyright (C) Remedy Entertainment Plc.
+
+#pragma once
+
+#include "DebugCodes.h"
+
+#include <pxr/base/tf/stopwatch.h>
+#include <pxr/pxr.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace remedy
+{
+	/// Keeps the most recently used frames of a TimeSampleSource that decodes or reads its samples on demand.
+	///
+	/// Frames are decoded outside of the lock so other frames do not wait on them. A thread asking for a frame that
+	/// another thread is decoding already waits for that decode instead of repeating it, so a frame is never decoded
+	/// twice at the same time nor inserted twice.
+	///
+	/// The time spent decoding is reported through USDFBX_PERF when the cache goes away.
+	template< typename T >
+	class TimeSampleCache
+	{
+	public:
+		/// Enough for playback: every property and prim served by the same source asks for the current frame in turn,
+		/// interpolating between two samples asks for the frames on both sides, and scrubbing back a frame is common.
+		static constexpr size_t DEFAULT_CAPACITY = 4;
+
+		/// \p description names what is decoded in the USDFBX_PERF report, e.g. "skinned points"
+		explicit TimeSampleCache( std::string description, size_t capacity = DEFAULT_CAPACITY )
+			: m_description( std::move( description ) )
+			, m_capacity( std::max< size_t >( capacity, 1 ) )
+		{
+		}
+
+		~TimeSampleCache()
+		{
+			if( m_numDecodes > 0 )
+			{
+				TF_DEBUG( USDFBX_PERF )
+					.Msg(
+						"UsdFbx - Decoded %zu frames of %s in %.3f ms (%.3f us per frame)\n",
+						m_numDecodes,
+						m_description.c_str(),
+						m_decodeSeconds * 1000.0,
+						m_decodeSeconds * 1000000.0 / m_numDecodes );
+			}
+		}
+
+		TimeSampleCache( const TimeSampleCache& ) = delete;
+		TimeSampleCache& operator=( const TimeSampleCache& ) = delete;
+
+		/// Returns the frame at \p frameIndex, calling \p decode( frameIndex ) when it is not cached
+		template< typename DecodeFn >
+		T Get( size_t frameIndex, DecodeFn&& decode )
+		{
+			std::unique_lock lock( m_mutex );
+			for( ;; )
+			{
+				const auto cacheIt = find( frameIndex );
+				if( cacheIt != m_frames.end() )
+				{
+					m_frames.splice( m_frames.begin(), m_frames, cacheIt );
+					return cacheIt->second;
+				}
+
+				if( m_decodingFrames.count( frameIndex ) == 0 )
+				{
+					break;
+				}
+
+				// Another thread is decoding it already
+				m_condition.wait( lock );
+			}
+
+			m_decodingFrames.insert( frameIndex );
+			lock.unlock();
+			TfStopwatch stopwatch;
+			stopwatch.Start();
+			T frame = decode( frameIndex );
+			stopwatch.Stop();
+			lock.lock();
+
+			m_decodingFrames.erase( frameIndex );
+			++m_numDecodes;
+			m_decodeSeconds += stopwatch.GetSeconds();
+			m_frames.emplace_front( frameIndex, frame );
+			if( m_frames.size() > m_capacity )
+			{
+				m_frames.pop_back();
+			}
+			m_condition.notify_all();
+			return frame;
+		}
+
+		/// Returns true when \p frameIndex is cached or being decoded, without touching its place in the cache
+		[[nodiscard]] bool Contains( size_t frameIndex ) const
+		{
+			std::lock_guard lock( m_mutex );
+			return find( frameIndex ) != m_frames.end() || m_decodingFrames.count( frameIndex ) > 0;
+		}
+
+	private:
+		using Frames = std::list< std::pair< size_t, T > >;
+
+		typename Frames::iterator find( size_t frameIndex )
+		{
+			return std::find_if(
+				m_frames.begin(),
+				m_frames.end(),
+				[ & ]( const auto& entry ) { return entry.first == frameIndex; } );
+		}
+
+		typename Frames::const_iterator find( size_t frameIndex ) const
+		{
+			return std::find_if(
+				m_frames.cbegin(),
+				m_frames.cend(),
+				[ & ]( const auto& entry ) { return entry.first == frameIndex; } );
+		}
+
+		std::string m_description;
+		size_t m_capacity;
+
+		mutable std::mutex m_mutex;
+		std::condition_variable m_condition;
+		// Most recently used first
+		Frames m_frames;
+		std::set< size_t > m_decodingFrames;
+		size_t m_numDecodes = 0;
+		double m_decodeSeconds = 0.0;
+	};
+} // namespace remedy
@@ -9,5 +9,6 @@ PXR_NAMESPACE_OPEN_SCOPE
 TF_DEFINE_PUBLIC_TOKENS( UsdFbxPrimTypeNames, USD_FBX_PRIM_TYPE_NAMES );
 TF_DEFINE_PUBLIC_TOKENS( UsdFbxDisplayGroupTokens, USD_FBX_DISPLAYGROUP_TOKENS );
 TF_DEFINE_PUBLIC_TOKENS( UsdFbxSchemaTokens, USD_FBX_SCHEMA_TOKENS );
+TF_DEFINE_PUBLIC_TOKENS( UsdFbxFileFormatArgumentTokens, USD_FBX_FILE_FORMAT_ARGUMENT_TOKENS );
 
 PXR_NAMESPACE_CLOSE_SCOPE
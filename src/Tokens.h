@@ -13,9 +13,11 @@ PXR_NAMESPACE_OPEN_SCOPE
     (Mesh) \
     (SkelRoot) \
     (Skeleton) \
+    (BlendShape) \
     (SkelAnimation) \
     (NurbsCurves) \
     (Points) \
+    (PointInstancer) \
     (PolyMesh) \
     (PseudoRoot) \
     (Scope) \
@@ -45,4 +47,26 @@ PXR_NAMESPACE_OPEN_SCOPE
 		UsdFbxSchemaTokens,
 		USD_FBX_SCHEMA_TOKENS );
 
+// File format arguments understood by the plugin, i.e. @file.fbx:SDF_FORMAT_ARGS:quantizeSkelAnimation=1@
+#define USD_FBX_FILE_FORMAT_ARGUMENT_TOKENS \
+    (quantizeSkelAnimation) \
+    (take) \
+    (takeVariants) \
+    (startFrame) \
+    (endFrame) \
+    (clipFrames) \
+    (clip) \
+    (clipManifest) \
+    (collapseStaticXforms) \
+    (maxInfluences) \
+    (minWeight) \
+    (bakeSkinning) \
+    (sequence) \
+    (pointInstancer) \
+    (mergeStatic) \
+    (flattenNulls)
+	TF_DECLARE_PUBLIC_TOKENS(
+		UsdFbxFileFormatArgumentTokens,
+		USD_FBX_FILE_FORMAT_ARGUMENT_TOKENS );
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -4,17 +4,26 @@
 
 #include "DebugCodes.h"
 #include "Error.h"
+#include "FbxFileSequence.h"
 #include "FbxNodeReader.h"
 #include "Helpers.h"
 #include "PrecompiledHeader.h"
 #include "Tokens.h"
 
+#include <algorithm>
 #include <fbxsdk.h>
 #include <fbxsdk/core/fbxsystemunit.h>
 #include <filesystem>
+#include <limits>
+#include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/trace/trace.h>
 #include <pxr/usd/kind/registry.h>
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/listOp.h>
+#include <pxr/usd/sdf/payload.h>
 #include <pxr/usd/sdf/schema.h>
+#include <pxr/usd/sdf/types.h>
+#include <pxr/usd/usd/clipsAPI.h>
 #include <pxr/usd/usd/tokens.h>
 #include <pxr/usd/usdGeom/metrics.h>
 #include <pxr/usd/usdGeom/tokens.h>
@@ -54,51 +63,109 @@ namespace
 		void operator=( const FbxGlobals& ) = delete;
 	};
 
-	std::tuple< FbxManager*, remedy::FbxPtr< FbxScene > > importFbxScene( const std::string& filePath )
+	/// Owns the importer along with the IOSettings it reads with, both must outlive the import
+	class FbxFileImporter
 	{
-		auto fbxSdkManager = FbxGlobals::getInstance().getManager();
-		const auto pIOSettings = remedy::FbxPtr< FbxIOSettings >( FbxIOSettings::Create( fbxSdkManager, IOSROOT ) );
-		auto scene = remedy::FbxPtr< FbxScene >( FbxScene::Create( fbxSdkManager, filePath.c_str() ) );
-		auto importer = remedy::FbxPtr< FbxImporter >( FbxImporter::Create( fbxSdkManager, "" ) );
+	public:
+		bool Initialize( FbxManager* fbxSdkManager, const std::string& filePath )
+		{
+			m_ioSettings.reset( FbxIOSettings::Create( fbxSdkManager, IOSROOT ) );
+			m_importer.reset( FbxImporter::Create( fbxSdkManager, "" ) );
+
+			m_ioSettings->SetBoolProp( IMP_FBX_MATERIAL, true );
+			m_ioSettings->SetBoolProp( IMP_FBX_TEXTURE, true );
+			m_ioSettings->SetBoolProp( IMP_FBX_LINK, true );
+			m_ioSettings->SetBoolProp( IMP_FBX_SHAPE, true );
+			m_ioSettings->SetBoolProp( IMP_FBX_GOBO, true );
+			m_ioSettings->SetBoolProp( IMP_FBX_ANIMATION, true );
+			m_ioSettings->SetBoolProp( IMP_FBX_GLOBAL_SETTINGS, true );
+			fbxSdkManager->SetIOSettings( m_ioSettings.get() );
+
+			TF_DEBUG( USDFBX ).Msg( "UsdFbx - Opening \"%s\"\n", filePath.c_str() );
+
+			int sdkMajor, sdkMinor, sdkRevision;
+			FbxManager::GetFileFormatVersion( sdkMajor, sdkMinor, sdkRevision );
+			TF_DEBUG( USDFBX ).Msg( "UsdFbx - Fbx version (%d.%d.%d)\n", sdkMajor, sdkMinor, sdkRevision );
+
+			const bool bImportStatus = m_importer->Initialize( filePath.c_str() );
+			if( !bImportStatus )
+			{
+				TF_ERROR( UsdFbxError::FBX_UNABLE_TO_OPEN, "[x] FBX import failed! Unable to initialize FbxImporter\n" );
+				return false;
+			}
 
-		pIOSettings->SetBoolProp( IMP_FBX_MATERIAL, true );
-		pIOSettings->SetBoolProp( IMP_FBX_TEXTURE, true );
-		pIOSettings->SetBoolProp( IMP_FBX_LINK, true );
-		pIOSettings->SetBoolProp( IMP_FBX_SHAPE, true );
-		pIOSettings->SetBoolProp( IMP_FBX_GOBO, true );
-		pIOSettings->SetBoolProp( IMP_FBX_ANIMATION, true );
-		pIOSettings->SetBoolProp( IMP_FBX_GLOBAL_SETTINGS, true );
-		fbxSdkManager->SetIOSettings( pIOSettings.get() );
+			int fileMajor, fileMinor, fileRevision;
+			m_importer->GetFileVersion( fileMajor, fileMinor, fileRevision );
+			TF_DEBUG( USDFBX ).Msg( "UsdFbx - File FBX version (%i.%i.%i)\n", fileMajor, fileMinor, fileRevision );
 
-		TF_DEBUG( USDFBX ).Msg( "UsdFbx - Opening \"%s\"\n", filePath.c_str() );
+			if( fileMajor > sdkMajor || ( fileMajor >= sdkMajor && fileMinor > sdkMinor ) )
+			{
+				TF_ERROR(
+					UsdFbxError::FBX_INCOMPATIBLE_VERSIONS,
+					"[x] FBX import failed! file version (%d.%d.%d) is newer than SDK "
+					"version (%d.%d.%d)\n",
+					fileMajor,
+					fileMinor,
+					fileRevision,
+					sdkMajor,
+					sdkMinor,
+					sdkRevision );
+				return false;
+			}
+			return true;
+		}
 
-		int sdkMajor, sdkMinor, sdkRevision;
-		FbxManager::GetFileFormatVersion( sdkMajor, sdkMinor, sdkRevision );
-		TF_DEBUG( USDFBX ).Msg( "UsdFbx - Fbx version (%d.%d.%d)\n", sdkMajor, sdkMinor, sdkRevision );
+		FbxImporter* get() const
+		{
+			return m_importer.get();
+		}
 
-		const bool bImportStatus = importer->Initialize( filePath.c_str() );
-		if( !bImportStatus )
+		FbxImporter* operator->() const
 		{
-			TF_ERROR( UsdFbxError::FBX_UNABLE_TO_OPEN, "[x] FBX import failed! Unable to initialize FbxImporter\n" );
-			return { nullptr, nullptr };
+			return get();
 		}
 
-		int fileMajor, fileMinor, fileRevision;
-		importer->GetFileVersion( fileMajor, fileMinor, fileRevision );
-		TF_DEBUG( USDFBX ).Msg( "UsdFbx - File FBX version (%i.%i.%i)\n", fileMajor, fileMinor, fileRevision );
+	private:
+		// Declared first so it is destroyed last
+		remedy::FbxPtr< FbxIOSettings > m_ioSettings;
+		remedy::FbxPtr< FbxImporter > m_importer;
+	};
+
+	/// Restricts the import to \p take, every other take in the file is skipped entirely
+	bool selectTake( FbxImporter* importer, const std::string& filePath, const std::string& take )
+	{
+		bool found = false;
+		for( int takeIndex = 0; takeIndex < importer->GetAnimStackCount(); ++takeIndex )
+		{
+			FbxTakeInfo* takeInfo = importer->GetTakeInfo( takeIndex );
+			takeInfo->mSelect = take == takeInfo->mName.Buffer();
+			found |= takeInfo->mSelect;
+		}
 
-		if( fileMajor > sdkMajor || ( fileMajor >= sdkMajor && fileMinor > sdkMinor ) )
+		if( !found )
 		{
 			TF_ERROR(
-				UsdFbxError::FBX_INCOMPATIBLE_VERSIONS,
-				"[x] FBX import failed! file version (%d.%d.%d) is newer than SDK "
-				"version (%d.%d.%d)\n",
-				fileMajor,
-				fileMinor,
-				fileRevision,
-				sdkMajor,
-				sdkMinor,
-				sdkRevision );
+				UsdFbxError::FBX_UNKNOWN_TAKE,
+				"[x] FBX import failed! \"%s\" has no take named \"%s\"\n",
+				filePath.c_str(),
+				take.c_str() );
+		}
+		return found;
+	}
+
+	std::tuple< FbxManager*, remedy::FbxPtr< FbxScene > > importFbxScene( const std::string& filePath, const std::string& take )
+	{
+		auto fbxSdkManager = FbxGlobals::getInstance().getManager();
+		auto scene = remedy::FbxPtr< FbxScene >( FbxScene::Create( fbxSdkManager, filePath.c_str() ) );
+
+		FbxFileImporter importer;
+		if( !importer.Initialize( fbxSdkManager, filePath ) )
+		{
+			return { nullptr, nullptr };
+		}
+
+		if( !take.empty() && !selectTake( importer.get(), filePath, take ) )
+		{
 			return { nullptr, nullptr };
 		}
 
@@ -112,6 +179,125 @@ namespace
 		return { fbxSdkManager, std::move( scene ) };
 	}
 
+	/// A scene imported for a take of a file, identified by the write time of the file
+	struct SharedScene
+	{
+		std::weak_ptr< FbxScene > scene;
+		std::filesystem::file_time_type writeTime;
+	};
+
+	/// Scenes that are still alive by file path and take. Value clips and their manifest open the same file as the
+	/// layer presenting them, which keeps its scene alive for them. Only accessed while holding mutex
+	std::map< std::pair< std::string, std::string >, SharedScene > sharedScenes;
+
+	/// Imports \p filePath like importFbxScene, unless a scene imported for the same take of the file is still alive.
+	/// Readers only read from the scene, several layers can be converted from the same one.
+	std::shared_ptr< FbxScene > importSharedFbxScene( const std::string& filePath, const std::string& take )
+	{
+		for( auto it = sharedScenes.begin(); it != sharedScenes.end(); )
+		{
+			it = it->second.scene.expired() ? sharedScenes.erase( it ) : std::next( it );
+		}
+
+		std::error_code error;
+		const auto writeTime = std::filesystem::last_write_time( filePath, error );
+		const auto key = std::make_pair( filePath, take );
+		const auto sharedIt = sharedScenes.find( key );
+		if( sharedIt != sharedScenes.end() && sharedIt->second.writeTime == writeTime )
+		{
+			if( auto scene = sharedIt->second.scene.lock() )
+			{
+				TF_DEBUG( USDFBX ).Msg( "UsdFbx - Reusing the scene imported from \"%s\"\n", filePath.c_str() );
+				return scene;
+			}
+		}
+
+		std::shared_ptr< FbxScene > scene( std::get< 1 >( importFbxScene( filePath, take ) ) );
+		if( scene )
+		{
+			sharedScenes[ key ] = { scene, writeTime };
+		}
+		return scene;
+	}
+
+	/// Lists the takes of a file from its header, without paying for importing the scene
+	bool readTakes(
+		const std::string& filePath,
+		std::vector< remedy::UsdFbxDataReader::TakeInfo >& takes,
+		double& timeCodesPerSecond )
+	{
+		FbxFileImporter importer;
+		if( !importer.Initialize( FbxGlobals::getInstance().getManager(), filePath ) )
+		{
+			return false;
+		}
+
+		FbxTime::EMode timeMode = FbxTime::eDefaultMode;
+		if( !importer->GetFrameRate( timeMode ) )
+		{
+			timeMode = FbxTime::eDefaultMode;
+		}
+		timeCodesPerSecond = FbxTime::GetFrameRate( timeMode );
+
+		for( int takeIndex = 0; takeIndex < importer->GetAnimStackCount(); ++takeIndex )
+		{
+			const FbxTakeInfo* takeInfo = importer->GetTakeInfo( takeIndex );
+			remedy::UsdFbxDataReader::TakeInfo& take = takes.emplace_back();
+			take.name = takeInfo->mName.Buffer();
+			take.startTimeCode = takeInfo->mLocalTimeSpan.GetStart().GetFrameCountPrecise( timeMode );
+			take.endTimeCode = takeInfo->mLocalTimeSpan.GetStop().GetFrameCountPrecise( timeMode );
+		}
+		return true;
+	}
+
+	/// Files of the numbered sequence \p filePath belongs to by frame number, mesh_0001.fbx is followed by mesh_0002.fbx.
+	/// Only files in the same directory with the same name and extension around the frame number are part of it.
+	std::vector< std::pair< double, std::string > > findSequenceFiles( const std::string& filePath )
+	{
+		const std::filesystem::path path( filePath );
+		const std::string stem = path.stem().generic_string();
+		const size_t frameStart = stem.find_last_not_of( "0123456789" ) + 1;
+		if( frameStart == stem.size() )
+		{
+			TF_WARN( "\"%s\" does not end in a frame number, it can not be read as a sequence", filePath.c_str() );
+			return {};
+		}
+
+		const std::string prefix = stem.substr( 0, frameStart );
+		std::vector< std::pair< double, std::string > > files;
+		std::error_code error;
+		const std::filesystem::path directory = path.has_parent_path() ? path.parent_path() : std::filesystem::path( "." );
+		for( const auto& entry : std::filesystem::directory_iterator( directory, error ) )
+		{
+			const std::string candidate = entry.path().stem().generic_string();
+			if( entry.path().extension() != path.extension() || candidate.size() <= prefix.size()
+				|| candidate.compare( 0, prefix.size(), prefix ) != 0
+				|| candidate.find_first_not_of( "0123456789", prefix.size() ) != std::string::npos )
+			{
+				continue;
+			}
+			files.emplace_back( std::stod( candidate.substr( prefix.size() ) ), entry.path().generic_string() );
+		}
+		std::sort( files.begin(), files.end() );
+		return files;
+	}
+
+	/// Variant sets are stored as a prim spec at /Prim{set=}, their variants at /Prim{set=variant}
+	bool isVariantSetPath( const SdfPath& path )
+	{
+		return path.IsPrimVariantSelectionPath() && path.GetVariantSelection().second.empty();
+	}
+
+	bool isPrimOrVariantPath( const SdfPath& path )
+	{
+		return path.IsAbsoluteRootOrPrimPath() || path.IsPrimVariantSelectionPath();
+	}
+
+	SdfPath getPrimOrVariantPath( const SdfPath& path )
+	{
+		return path.IsAbsoluteRootPath() ? path : path.GetPrimOrPrimVariantSelectionPath();
+	}
+
 	bool getPropertyValue( const remedy::UsdFbxDataReader::Property* property, VtValue* value )
 	{
 		TRACE_FUNCTION()
@@ -141,7 +327,14 @@ namespace
 
 		// If we're not dealing with the default time code, we need to fetch the value
 		// of this property at that time
-		if( !timeCode.IsDefault() )
+		if( !timeCode.IsDefault() && prop->timeSampleSource )
+		{
+			if( !prop->timeSampleSource->Get( timeCode.GetValue(), &val ) )
+			{
+				return false;
+			}
+		}
+		else if( !timeCode.IsDefault() )
 		{
 			const auto it = std::find_if(
 				prop->timeSamples.cbegin(),
@@ -175,7 +368,17 @@ namespace
 			val = VtValue( res );
 		}
 
-		if( fieldName == SdfFieldKeys->TimeSamples && !prop->timeSamples.empty() )
+		if( fieldName == SdfFieldKeys->TimeSamples && prop->timeSampleSource )
+		{
+			// Expands every sample, only happens when the whole map is requested (i.e. exporting the layer)
+			SdfTimeSampleMap samples;
+			for( const double time : prop->timeSampleSource->GetTimes() )
+			{
+				prop->timeSampleSource->Get( time, &samples[ time ] );
+			}
+			val = VtValue( samples );
+		}
+		else if( fieldName == SdfFieldKeys->TimeSamples && !prop->timeSamples.empty() )
 		{
 			// Fill a map of values over all time samples.
 			SdfTimeSampleMap samples;
@@ -223,7 +426,7 @@ namespace
 
 		if( !isPseudoRoot )
 		{
-			if( fieldName == SdfFieldKeys->TypeName )
+			if( fieldName == SdfFieldKeys->TypeName && !prim->typeName.IsEmpty() )
 			{
 				val = VtValue( prim->typeName );
 			}
@@ -336,9 +539,152 @@ namespace
 		FbxNode* node,
 		const SdfPath& parentPath,
 		remedy::UsdFbxDataReader::Prim& parentPrim,
-		FbxAnimLayer* animLayer,
-		FbxTimeSpan animTimeSpan,
-		const double scaleFactor )
+		remedy::FbxSceneReaderContext& sceneContext );
+
+	/// Pass-through nulls are left out when flattening, unless one of their children would take the name of a prim
+	/// next to them in \p parentPrim
+	bool isFlattenedNull(
+		FbxNode* node,
+		const remedy::UsdFbxDataReader::Prim& parentPrim,
+		remedy::FbxSceneReaderContext& sceneContext )
+	{
+		if( !remedy::IsPassThroughNull( node, sceneContext ) )
+		{
+			return false;
+		}
+
+		std::set< TfToken > siblingNames( parentPrim.children.cbegin(), parentPrim.children.cend() );
+		const FbxNode* parent = node->GetParent();
+		for( int childId = 0; childId < parent->GetChildCount(); ++childId )
+		{
+			if( parent->GetChild( childId ) != node )
+			{
+				siblingNames.insert( TfToken( remedy::cleanName( parent->GetChild( childId )->GetName() ) ) );
+			}
+		}
+		for( int childId = 0; childId < node->GetChildCount(); ++childId )
+		{
+			if( siblingNames.count( TfToken( remedy::cleanName( node->GetChild( childId )->GetName() ) ) ) > 0 )
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/// Adds \p node to the meshes merged with the other nodes using the same materials
+	void addMergedMesh( FbxNode* node, remedy::FbxSceneReaderContext& sceneContext )
+	{
+		// Materials of the same name are the same USD material
+		std::vector< std::string > materialNames;
+		for( int materialIndex = 0; materialIndex < node->GetMaterialCount(); ++materialIndex )
+		{
+			materialNames.push_back( remedy::cleanName( node->GetMaterial( materialIndex )->GetName() ) );
+		}
+
+		auto& mergedMeshes = sceneContext.mergedMeshes;
+		const auto mergedIt = std::find_if(
+			mergedMeshes.begin(),
+			mergedMeshes.end(),
+			[ & ]( const auto& merged ) { return merged.first == materialNames; } );
+		if( mergedIt == mergedMeshes.end() )
+		{
+			mergedMeshes.emplace_back( std::move( materialNames ), std::vector< FbxNode* >{ node } );
+		}
+		else
+		{
+			mergedIt->second.push_back( node );
+		}
+	}
+
+	/// Writes the merged meshes under \p parentPath, named after their materials
+	void readMergedMeshes(
+		remedy::UsdFbxDataReader& context,
+		const SdfPath& parentPath,
+		remedy::UsdFbxDataReader::Prim& parentPrim,
+		remedy::FbxSceneReaderContext& sceneContext )
+	{
+		const TfToken mergedName( "MERGED" );
+		parentPrim.children.push_back( mergedName );
+		const SdfPath mergedPath = parentPath.AppendChild( mergedName );
+		remedy::UsdFbxDataReader::Prim& mergedPrim = context.AddPrim( mergedPath );
+		mergedPrim.typeName = UsdFbxPrimTypeNames->Scope;
+
+		std::set< std::string > usedNames;
+		for( const auto& [ materialNames, nodes ] : sceneContext.mergedMeshes )
+		{
+			const std::string baseName = materialNames.empty() ? "unbound" : TfStringJoin( materialNames, "_" );
+			std::string name = baseName;
+			for( int suffix = 1; usedNames.count( name ) > 0; ++suffix )
+			{
+				name = TfStringPrintf( "%s_%d", baseName.c_str(), suffix );
+			}
+			usedNames.insert( name );
+
+			remedy::FbxNodeReaderContext meshContext(
+				context,
+				nodes.front(),
+				mergedPath.AppendChild( TfToken( name ) ),
+				sceneContext );
+			remedy::ReadMergedMesh( meshContext, nodes );
+		}
+	}
+
+	/// Collects the children of \p node into the prim at \p nodePath. With pointInstancer, the children that can be
+	/// drawn by a point instancer are gathered into one instead, as long as there are at least two of them.
+	void collectChildNodes(
+		remedy::UsdFbxDataReader& context,
+		FbxNode* node,
+		const SdfPath& nodePath,
+		remedy::UsdFbxDataReader::Prim& prim,
+		remedy::FbxSceneReaderContext& sceneContext )
+	{
+		std::vector< FbxNode* > instances;
+		if( context.GetOptions().pointInstancer )
+		{
+			for( int childId = 0; childId < node->GetChildCount(); ++childId )
+			{
+				FbxNode* child = node->GetChild( childId );
+				if( remedy::IsPointInstance( child, context.GetOptions(), sceneContext ) )
+				{
+					instances.push_back( child );
+				}
+			}
+			if( instances.size() < 2 )
+			{
+				instances.clear();
+			}
+		}
+
+		for( int childId = 0; childId < node->GetChildCount(); ++childId )
+		{
+			FbxNode* child = node->GetChild( childId );
+			if( std::find( instances.cbegin(), instances.cend(), child ) == instances.cend() )
+			{
+				collectFbxNodes( context, child, nodePath, prim, sceneContext );
+			}
+		}
+
+		if( !instances.empty() )
+		{
+			// Upper case like the other prims that do not come from a node, MATERIALS and MESHES. Flattened nulls
+			// collect their children into the prim of their parent, which may have an instancer already.
+			SdfPath instancerPath = nodePath.AppendChild( TfToken( "INSTANCES" ) );
+			for( int suffix = 1; context.GetPrim( instancerPath ); ++suffix )
+			{
+				instancerPath = nodePath.AppendChild( TfToken( TfStringPrintf( "INSTANCES_%d", suffix ) ) );
+			}
+			remedy::FbxNodeReaderContext instancerContext( context, instances.front(), instancerPath, sceneContext );
+			remedy::ReadPointInstancer( instancerContext, instances );
+		}
+	}
+
+	void collectFbxNodes(
+		remedy::UsdFbxDataReader& context,
+		FbxNode* node,
+		const SdfPath& parentPath,
+		remedy::UsdFbxDataReader::Prim& parentPrim,
+		remedy::FbxSceneReaderContext& sceneContext )
 	{
 		// We bail out when we encounter an FBXNode that has not attribute pointer
 		// (very rare) but is also not covered by a reader. Usd _demands_ that any
@@ -349,7 +695,27 @@ namespace
 			return;
 		}
 
-		const auto readers = getFbxNodeReaders( attr->GetAttributeType() );
+		// Pass-through nulls leave no prim behind, their children are collected straight into the parent
+		if( context.GetOptions().flattenNulls && isFlattenedNull( node, parentPrim, sceneContext ) )
+		{
+			TF_DEBUG( USDFBX ).Msg( "UsdFbx - Flattening pass-through null \"%s\"\n", node->GetName() );
+			collectChildNodes( context, node, parentPath, parentPrim, sceneContext );
+			return;
+		}
+
+		// Merged meshes only leave the transform of their node behind, for its children, or nothing at all
+		const bool isMerged = context.GetOptions().mergeStatic
+							  && remedy::IsMergeableMesh( node, context.GetOptions(), sceneContext );
+		if( isMerged )
+		{
+			addMergedMesh( node, sceneContext );
+			if( node->GetChildCount() == 0 )
+			{
+				return;
+			}
+		}
+
+		const auto readers = getFbxNodeReaders( isMerged ? FbxNodeAttribute::eNull : attr->GetAttributeType() );
 		if( readers.empty() )
 		{
 			return;
@@ -372,7 +738,7 @@ namespace
 		}
 
 		const SdfPath nodePath = parentPath.AppendChild( TfToken( name ) );
-		remedy::FbxNodeReaderContext primContext( context, node, nodePath, animLayer, animTimeSpan, scaleFactor );
+		remedy::FbxNodeReaderContext primContext( context, node, nodePath, sceneContext );
 		for( const auto& reader : readers )
 		{
 			reader( primContext );
@@ -388,48 +754,118 @@ namespace
 
 		parentPrim.children.push_back( TfToken( name ) );
 		remedy::UsdFbxDataReader::Prim& newPrim = context.AddPrim( nodePath );
-		for( size_t i = 0, n = node->GetChildCount(); i != n; ++i )
+		collectChildNodes( context, node, nodePath, newPrim, sceneContext );
+	}
+
+	bool getBoolArgument( const SdfFileFormat::FileFormatArguments& args, const TfToken& name, bool fallback )
+	{
+		const auto it = args.find( name.GetString() );
+		if( it == args.end() )
 		{
-			FbxNode* child = node->GetChild( static_cast< int >( i ) );
-			collectFbxNodes( context, child, nodePath, newPrim, animLayer, animTimeSpan, scaleFactor );
+			return fallback;
 		}
+		const std::string value = TfStringToLower( it->second );
+		return value == "1" || value == "true" || value == "on" || value == "yes";
 	}
 
-	void bakeAnimationLayers( FbxScene* scene, FbxAnimStack* animStack )
+	std::optional< double > getDoubleArgument( const SdfFileFormat::FileFormatArguments& args, const TfToken& name )
 	{
-		FbxAnimEvaluator* pEvaluator = scene->GetAnimationEvaluator();
-		const double framerate = FbxTime::GetFrameRate( scene->GetGlobalSettings().GetTimeMode() );
-		const FbxTimeSpan timeSpan = animStack->GetLocalTimeSpan();
-		const FbxTime lclStart = timeSpan.GetStart();
-		const FbxTime lclStop = timeSpan.GetStop();
-		FbxTime fbxBakePeriod;
-		fbxBakePeriod.SetSecondDouble( 1.0 / framerate );
-		animStack->BakeLayers( pEvaluator, lclStart, lclStop, fbxBakePeriod );
+		const auto it = args.find( name.GetString() );
+		if( it == args.end() )
+		{
+			return std::nullopt;
+		}
+
+		char* end = nullptr;
+		const double value = std::strtod( it->second.c_str(), &end );
+		if( end == it->second.c_str() || *end != '\0' )
+		{
+			TF_WARN( "Ignoring file format argument %s=\"%s\", expected a number", name.GetText(), it->second.c_str() );
+			return std::nullopt;
+		}
+		return value;
 	}
 
-	void processAnimations( FbxNode* node, FbxAnimLayer* animLayer )
+	/// Restricts \p timeSpan to the startFrame/endFrame window, if one was requested
+	FbxTimeSpan clampTimeSpan( const FbxTimeSpan& timeSpan, const remedy::UsdFbxDataReader::Options& options )
 	{
-		std::vector< FbxProperty > propertiesWithCurves;
-		for( FbxProperty property = node->GetFirstProperty(); property.IsValid(); property = node->GetNextProperty( property ) )
+		if( !options.startFrame && !options.endFrame )
 		{
-			if( property.GetCurveNode( animLayer ) == nullptr )
-			{
-				continue;
-			}
+			return timeSpan;
+		}
+
+		FbxTime start = std::min( timeSpan.GetStart(), timeSpan.GetStop() );
+		FbxTime stop = std::max( timeSpan.GetStart(), timeSpan.GetStop() );
+		if( options.startFrame )
+		{
+			FbxTime windowStart;
+			windowStart.SetFramePrecise( *options.startFrame );
+			start = std::max( start, windowStart );
+		}
+		if( options.endFrame )
+		{
+			FbxTime windowStop;
+			windowStop.SetFramePrecise( *options.endFrame );
+			stop = std::min( stop, windowStop );
+		}
+
+		if( stop < start )
+		{
+			TF_WARN(
+				"Frame window [%g, %g] does not overlap the take [%g, %g], only frame %g is sampled",
+				options.startFrame.value_or( start.GetFrameCountPrecise() ),
+				options.endFrame.value_or( stop.GetFrameCountPrecise() ),
+				std::min( timeSpan.GetStart(), timeSpan.GetStop() ).GetFrameCountPrecise(),
+				std::max( timeSpan.GetStart(), timeSpan.GetStop() ).GetFrameCountPrecise(),
+				start.GetFrameCountPrecise() );
+			stop = start;
+		}
+		return { start, stop };
+	}
 
-			const EFbxType ePropertyType = property.GetPropertyDataType().GetType();
+	remedy::UsdFbxDataReader::Options parseOptions( const SdfFileFormat::FileFormatArguments& args )
+	{
+		remedy::UsdFbxDataReader::Options options;
+		options.quantizeSkelAnimation
+			= getBoolArgument( args, UsdFbxFileFormatArgumentTokens->quantizeSkelAnimation, options.quantizeSkelAnimation );
+		options.takeVariants = getBoolArgument( args, UsdFbxFileFormatArgumentTokens->takeVariants, options.takeVariants );
 
-			if( ( ePropertyType == eFbxHalfFloat ) || ( ePropertyType == eFbxFloat ) || ( ePropertyType == eFbxDouble ) )
-			{
-				propertiesWithCurves.push_back( property );
-			}
+		const auto takeIt = args.find( UsdFbxFileFormatArgumentTokens->take.GetString() );
+		if( takeIt != args.end() )
+		{
+			options.take = takeIt->second;
 		}
 
-		for( size_t i = 0, n = node->GetChildCount(); i != n; ++i )
+		options.startFrame = getDoubleArgument( args, UsdFbxFileFormatArgumentTokens->startFrame );
+		options.endFrame = getDoubleArgument( args, UsdFbxFileFormatArgumentTokens->endFrame );
+
+		const auto clipFrames = getDoubleArgument( args, UsdFbxFileFormatArgumentTokens->clipFrames );
+		if( clipFrames && *clipFrames >= 1.0 )
+		{
+			options.clipFrames = static_cast< size_t >( *clipFrames );
+		}
+		options.clip = getBoolArgument( args, UsdFbxFileFormatArgumentTokens->clip, options.clip );
+		options.clipManifest = getBoolArgument( args, UsdFbxFileFormatArgumentTokens->clipManifest, options.clipManifest );
+		options.collapseStaticXforms
+			= getBoolArgument( args, UsdFbxFileFormatArgumentTokens->collapseStaticXforms, options.collapseStaticXforms );
+
+		const auto maxInfluences = getDoubleArgument( args, UsdFbxFileFormatArgumentTokens->maxInfluences );
+		if( maxInfluences && *maxInfluences >= 1.0 )
+		{
+			options.maxInfluences = static_cast< size_t >( *maxInfluences );
+		}
+		const auto minWeight = getDoubleArgument( args, UsdFbxFileFormatArgumentTokens->minWeight );
+		if( minWeight && *minWeight > 0.0 )
 		{
-			FbxNode* child = node->GetChild( static_cast< int >( i ) );
-			processAnimations( child, animLayer );
+			options.minWeight = static_cast< float >( *minWeight );
 		}
+		options.bakeSkinning = getBoolArgument( args, UsdFbxFileFormatArgumentTokens->bakeSkinning, options.bakeSkinning );
+		options.sequence = getBoolArgument( args, UsdFbxFileFormatArgumentTokens->sequence, options.sequence );
+		options.pointInstancer
+			= getBoolArgument( args, UsdFbxFileFormatArgumentTokens->pointInstancer, options.pointInstancer );
+		options.mergeStatic = getBoolArgument( args, UsdFbxFileFormatArgumentTokens->mergeStatic, options.mergeStatic );
+		options.flattenNulls = getBoolArgument( args, UsdFbxFileFormatArgumentTokens->flattenNulls, options.flattenNulls );
+		return options;
 	}
 
 	std::string axisSystemToString( const FbxAxisSystem& axisSystem )
@@ -471,8 +907,60 @@ namespace
 			frontVectorSign < 0 ? '-' : '+',
 			axisStringMap.at( frontVectorAxisID ) );
 	}
+
+	/// Reports how \p scene is converted to Y-up and centimeters, which is what USD gets from every scene. The readers
+	/// convert what they read, the scene itself is left as it is.
+	remedy::FbxSceneConversion getSceneConversion( const FbxScene* scene )
+	{
+		const remedy::FbxSceneConversion conversion = remedy::GetSceneConversion( scene );
+		if( conversion.ConvertsAxis() )
+		{
+			TF_DEBUG( USDFBX ).Msg(
+				"UsdFbx - Converting from %s to %s Coordinate system\n",
+				axisSystemToString( scene->GetGlobalSettings().GetAxisSystem() ).c_str(),
+				axisSystemToString( FbxAxisSystem::MayaYUp ).c_str() );
+		}
+		else
+		{
+			TF_DEBUG( USDFBX ).Msg(
+				"UsdFbx - Scene already uses the %s Coordinate system\n",
+				axisSystemToString( FbxAxisSystem::MayaYUp ).c_str() );
+		}
+
+		if( conversion.ConvertsUnits() )
+		{
+			TF_DEBUG( USDFBX ).Msg(
+				"UsdFbx - Converting from %f to %f metersPerUnit\n",
+				scene->GetGlobalSettings().GetSystemUnit().GetConversionFactorTo( FbxSystemUnit::m ),
+				FbxSystemUnit::cm.GetConversionFactorTo( FbxSystemUnit::m ) );
+		}
+		return conversion;
+	}
+
+	/// Reads the mesh points of one file of a sequence, converted like the first file of the sequence. The FBX SDK is
+	/// shared with Open, files are read one at a time
+	remedy::FbxFileSequence::FramePoints readSequenceFrame( const std::string& filePath )
+	{
+		std::lock_guard lock( mutex );
+		const auto [ fbxManager, scene ] = importFbxScene( filePath, {} );
+		if( !scene )
+		{
+			return {};
+		}
+		return remedy::ReadMeshPoints( scene.get() );
+	}
 } // namespace
 
+remedy::UsdFbxDataReader::~UsdFbxDataReader()
+{
+	// Scenes are destroyed under the same lock they are imported under, they share the FbxManager
+	if( m_clipScene )
+	{
+		std::lock_guard lock( mutex );
+		m_clipScene.reset();
+	}
+}
+
 bool remedy::UsdFbxDataReader::Open( const std::string& filePath, const SdfFileFormat::FileFormatArguments& args )
 {
 	TRACE_FUNCTION()
@@ -480,9 +968,61 @@ bool remedy::UsdFbxDataReader::Open( const std::string& filePath, const SdfFileF
 	// the underlying FbxManager.
 	std::lock_guard lock( mutex );
 
-	FbxManager* fbxManager = nullptr;
-	FbxPtr< FbxScene > scene = nullptr;
-	std::tie( fbxManager, scene ) = importFbxScene( filePath );
+	m_options = parseOptions( args );
+
+	if( m_options.takeVariants )
+	{
+		std::vector< TakeInfo > takes;
+		double timeCodesPerSecond = 0.0;
+		if( !readTakes( filePath, takes, timeCodesPerSecond ) )
+		{
+			TF_DEBUG( USDFBX ).Msg( "UsdFbx - Failed to read takes\n" );
+			return false;
+		}
+
+		const bool hasTake = m_options.take.empty()
+							 || std::any_of(
+								 takes.cbegin(),
+								 takes.cend(),
+								 [ & ]( const TakeInfo& take ) { return take.name == m_options.take; } );
+		if( !hasTake )
+		{
+			TF_ERROR(
+				UsdFbxError::FBX_UNKNOWN_TAKE,
+				"[x] FBX import failed! \"%s\" has no take named \"%s\"\n",
+				filePath.c_str(),
+				m_options.take.c_str() );
+			return false;
+		}
+
+		// Take names are passed on to the payloads as file format arguments, which cannot carry these characters
+		takes.erase(
+			std::remove_if(
+				takes.begin(),
+				takes.end(),
+				[ & ]( const TakeInfo& take )
+				{
+					if( take.name.find_first_of( "&=:[]@" ) == std::string::npos )
+					{
+						return false;
+					}
+					TF_WARN(
+						"%s: Take \"%s\" cannot be passed as a file format argument and is not exposed as a variant",
+						filePath.c_str(),
+						take.name.c_str() );
+					return true;
+				} ),
+			takes.end() );
+
+		if( !takes.empty() )
+		{
+			createTakeVariants( filePath, args, takes, timeCodesPerSecond );
+			return true;
+		}
+		TF_DEBUG( USDFBX ).Msg( "UsdFbx - No takes to create variants for, converting the scene as is\n" );
+	}
+
+	const std::shared_ptr< FbxScene > scene = importSharedFbxScene( filePath, m_options.take );
 
 	if( !scene )
 	{
@@ -529,16 +1069,6 @@ bool remedy::UsdFbxDataReader::Open( const std::string& filePath, const SdfFileF
 			axisStringMap.find( authoredSceneUp )->second );
 	}
 
-	TF_DEBUG( USDFBX ).Msg(
-		"UsdFbx - Converting from %s to %s Coordinate system\n",
-		axisSystemToString( scene->GetGlobalSettings().GetAxisSystem() ).c_str(),
-		axisSystemToString( FbxAxisSystem::MayaYUp ).c_str() );
-	FbxAxisSystem::MayaYUp.DeepConvertScene( scene.get() );
-
-	TF_DEBUG( USDFBX ).Msg(
-		"UsdFbx - Converting from %f to %f metersPerUnit\n",
-		scene->GetGlobalSettings().GetSystemUnit().GetConversionFactorTo( FbxSystemUnit::m ),
-		FbxSystemUnit::cm.GetConversionFactorTo( FbxSystemUnit::m ) );
 	const auto conversionFactorToCm = FbxSystemUnit::cm.GetConversionFactorFrom( scene->GetGlobalSettings().GetSystemUnit() );
 	TF_DEBUG( USDFBX ).Msg(
 		"UsdFbx - Current System Units -> %s\n",
@@ -553,8 +1083,8 @@ bool remedy::UsdFbxDataReader::Open( const std::string& filePath, const SdfFileF
 		"UsdFbx - conversion factor used for geometry data "
 		"using ScaleFactor -> %f\n",
 		conversionFactorToCm );
-	FbxSystemUnit::cm.ConvertScene( scene.get() );
-	const auto conversionFactorToMeter = scene->GetGlobalSettings().GetSystemUnit().GetConversionFactorTo( FbxSystemUnit::m );
+	const FbxSceneConversion conversion = getSceneConversion( scene.get() );
+	const auto conversionFactorToMeter = FbxSystemUnit::cm.GetConversionFactorTo( FbxSystemUnit::m );
 	TF_DEBUG( USDFBX ).Msg( "UsdFbx - new metersPerUnit: %f\n", conversionFactorToMeter );
 	TF_DEBUG( USDFBX ).Msg( "UsdFbx - new Up Axis: %s\n", UsdGeomTokens->y.GetText() );
 
@@ -569,7 +1099,9 @@ bool remedy::UsdFbxDataReader::Open( const std::string& filePath, const SdfFileF
 	Prim& rootPrim = *m_pseudoRoot;
 	TfToken defaultPrim;
 
+	// Nodes above skeletons are collected in the same pass, each ancestor is only walked up from once
 	bool sceneHasSkeletons = false;
+	std::set< const FbxNode* > skeletonAncestors;
 	for( int nodeIndex = 0; nodeIndex < scene->GetNodeCount(); ++nodeIndex )
 	{
 		const auto* node = scene->GetNode( nodeIndex );
@@ -580,32 +1112,58 @@ bool remedy::UsdFbxDataReader::Open( const std::string& filePath, const SdfFileF
 		if( node->GetNodeAttribute() && node->GetNodeAttribute()->GetAttributeType() == FbxNodeAttribute::eSkeleton )
 		{
 			sceneHasSkeletons = true;
-			break;
+			const FbxNode* ancestor = node->GetParent();
+			while( ancestor != nullptr && skeletonAncestors.insert( ancestor ).second )
+			{
+				ancestor = ancestor->GetParent();
+			}
 		}
 	}
 
 	const bool sceneHasAnimation = scene->GetSrcObjectCount< FbxAnimStack >() > 0;
+	const bool presentAsValueClips = m_options.clipFrames > 0 && !m_options.clip && !m_options.clipManifest;
+	FbxAnimStack* animStack = nullptr;
 	FbxAnimLayer* animLayer = nullptr;
 	FbxTimeSpan animTimeSpan;
+	double startTimeCode = 0.0;
+	double endTimeCode = 0.0;
 	if( sceneHasAnimation )
 	{
 		TF_DEBUG( USDFBX ).Msg( "UsdFbx - Scene has animation data, authoring layer metrics\n" );
 		FbxArray< FbxString* > animStackNames;
 		scene->FillAnimStackNameArray( animStackNames );
-		const auto animStack = scene->FindMember< FbxAnimStack >( animStackNames[ 0 ]->Buffer() );
+		const std::string takeName = m_options.take.empty() ? animStackNames[ 0 ]->Buffer() : m_options.take;
+		animStack = scene->FindMember< FbxAnimStack >( takeName.c_str() );
+		if( !animStack )
+		{
+			TF_ERROR( UsdFbxError::FBX_UNKNOWN_TAKE, "[x] FBX import failed! Unable to find take \"%s\"\n", takeName.c_str() );
+			return false;
+		}
+		TF_DEBUG( USDFBX ).Msg( "UsdFbx - Converting take \"%s\"\n", takeName.c_str() );
+		// The evaluator samples whichever stack is current
+		scene->SetCurrentAnimationStack( animStack );
+
+		// Only the requested frame window is sampled
+		animTimeSpan = clampTimeSpan( animStack->GetLocalTimeSpan(), m_options );
+		const FbxTime lclStart = animTimeSpan.GetStart();
+		const FbxTime lclStop = animTimeSpan.GetStop();
+		startTimeCode = lclStart.GetFrameCountPrecise( FbxTime::eDefaultMode );
+		endTimeCode = lclStop.GetFrameCountPrecise( FbxTime::eDefaultMode );
 
-		// Bake and resample multiple animlayers to the base layer
-		// This does not bake keys! It only merges multiple anim layers to a
-		// singular one
-		bakeAnimationLayers( scene.get(), animStack );
+		// The main layer and the manifest of value clips only need to know what is animated, the samples
+		// themselves come from the clips
+		if( presentAsValueClips || m_options.clipManifest )
+		{
+			animTimeSpan = FbxTimeSpan( lclStart, lclStart );
+		}
+
+		// Layers are not baked, stacks with several layers are blended by the evaluator as each channel is sampled
 		animLayer = animStack->GetMember< FbxAnimLayer >( 0 );
+		TF_DEBUG( USDFBX ).Msg( "UsdFbx - Take has %d anim layers\n", animStack->GetMemberCount< FbxAnimLayer >() );
 
 		// Write out start/stop timecode for the layer
-		animTimeSpan = animStack->GetLocalTimeSpan();
-		const FbxTime lclStart = animTimeSpan.GetStart();
-		const FbxTime lclStop = animTimeSpan.GetStop();
-		m_pseudoRoot->metadata[ SdfFieldKeys->StartTimeCode ] = VtValue( lclStart.GetFrameCountPrecise( FbxTime::eDefaultMode ) );
-		m_pseudoRoot->metadata[ SdfFieldKeys->EndTimeCode ] = VtValue( lclStop.GetFrameCountPrecise( FbxTime::eDefaultMode ) );
+		m_pseudoRoot->metadata[ SdfFieldKeys->StartTimeCode ] = VtValue( startTimeCode );
+		m_pseudoRoot->metadata[ SdfFieldKeys->EndTimeCode ] = VtValue( endTimeCode );
 		m_pseudoRoot->metadata[ SdfFieldKeys->TimeCodesPerSecond ]
 			= VtValue( FbxTime::GetFrameRate( scene->GetGlobalSettings().GetTimeMode() ) );
 		// Not 100% certain this is needed. As Usd generally deals with TimeCodes,
@@ -629,24 +1187,58 @@ bool remedy::UsdFbxDataReader::Open( const std::string& filePath, const SdfFileF
 
 	// Always create a "buffer" root sort to speak. If we're dealing with
 	// FbxSkeletons in the scene we make this root also a SkeletonRoot The root is
-	// always tagged as a component
+	// always tagged as a component. Blend shapes are driven through UsdSkel too
+	const bool isSkelRoot = sceneHasSkeletons || scene->GetSrcObjectCount< FbxBlendShape >() > 0;
 	const TfToken name( "ROOT" );
 	rootPrim.children.push_back( name );
 	const SdfPath nodePath = rootPath.AppendChild( name );
 	Prim& newPrim = AddPrim( nodePath );
-	newPrim.typeName = sceneHasSkeletons ? UsdFbxPrimTypeNames->SkelRoot : UsdFbxPrimTypeNames->Scope;
+	newPrim.typeName = isSkelRoot ? UsdFbxPrimTypeNames->SkelRoot : UsdFbxPrimTypeNames->Scope;
 	newPrim.metadata[ SdfFieldKeys->Kind ] = VtValue( KindTokens->component );
 	// The owning prim _must_ have the skeletonBindingAPI applied, not doing so
 	// will result in a bunch of deprecation warnings in 21.11
-	if( sceneHasSkeletons )
+	if( isSkelRoot )
 	{
-		TF_DEBUG( USDFBX ).Msg( "UsdFbx - Scene has skeletons, adding SkelBindingAPI to </%s>\n", name.GetText() );
+		TF_DEBUG( USDFBX )
+			.Msg( "UsdFbx - Scene has skeletons or blend shapes, adding SkelBindingAPI to </%s>\n", name.GetText() );
 		newPrim.metadata.emplace( UsdTokens->apiSchemas, VtValue( SdfTokenListOp::Create( { TfToken( "SkelBindingAPI" ) } ) ) );
 	}
 
-	for( int childId = 0; childId < root->GetChildCount(); ++childId )
+	FbxSceneReaderContext sceneContext;
+	sceneContext.animLayer = animLayer;
+	sceneContext.animTimeSpan = animTimeSpan;
+	sceneContext.conversion = conversion;
+	sceneContext.animatedChannels = FbxAnimatedChannelIndex( animStack );
+	sceneContext.skeletons = FbxSkeletonTable( nodePath );
+	sceneContext.skeletonAncestors = std::move( skeletonAncestors );
+	collectChildNodes( *this, root, nodePath, newPrim, sceneContext );
+	if( !sceneContext.mergedMeshes.empty() )
+	{
+		readMergedMeshes( *this, nodePath, newPrim, sceneContext );
+	}
+
+	// Every animated channel of the scene is known now, sample them all in one pass over the frames
+	sceneContext.animationSampler.Sample( animTimeSpan );
+
+	if( m_options.sequence )
 	{
-		collectFbxNodes( *this, root->GetChild( childId ), nodePath, newPrim, animLayer, animTimeSpan, conversionFactorToCm );
+		readSequence(
+			filePath,
+			sceneContext.sequencePoints,
+			FbxTime::GetFrameRate( scene->GetGlobalSettings().GetTimeMode() ) );
+	}
+
+	if( sceneHasAnimation )
+	{
+		if( m_options.clip || m_options.clipManifest )
+		{
+			keepAnimatedProperties( m_options.clip );
+		}
+		else if( presentAsValueClips )
+		{
+			m_clipScene = scene;
+			createValueClips( filePath, args, startTimeCode, endTimeCode );
+		}
 	}
 
 	if( !m_pseudoRoot->children.empty() )
@@ -655,9 +1247,272 @@ bool remedy::UsdFbxDataReader::Open( const std::string& filePath, const SdfFileF
 		m_pseudoRoot->metadata[ SdfFieldKeys->DefaultPrim ] = VtValue( m_pseudoRoot->children[ 0 ] );
 	}
 
+	reportSampleCounts();
 	return true;
 }
 
+void remedy::UsdFbxDataReader::createTakeVariants(
+	const std::string& filePath,
+	const SdfFileFormat::FileFormatArguments& args,
+	const std::vector< TakeInfo >& takes,
+	double timeCodesPerSecond )
+{
+	TRACE_FUNCTION()
+
+	const std::string fileName = std::filesystem::path( filePath ).filename().generic_string();
+	TF_DEBUG( USDFBX ).Msg( "UsdFbx - Exposing %zu takes of \"%s\" as variants\n", takes.size(), fileName.c_str() );
+
+	// Layer metrics have to match the payloaded layers, they do not compose through payloads
+	const SdfPath rootPath = SdfPath::AbsoluteRootPath();
+	m_pseudoRoot = &AddPrim( rootPath );
+	m_pseudoRoot->metadata[ SdfFieldKeys->Documentation ] = "Generated by UsdFbx";
+	m_pseudoRoot->metadata[ UsdGeomTokens->upAxis ] = VtValue( UsdGeomTokens->y );
+	m_pseudoRoot->metadata[ UsdGeomTokens->metersPerUnit ]
+		= VtValue( FbxSystemUnit::cm.GetConversionFactorTo( FbxSystemUnit::m ) );
+
+	double startTimeCode = std::numeric_limits< double >::max();
+	double endTimeCode = std::numeric_limits< double >::lowest();
+	for( const TakeInfo& take : takes )
+	{
+		startTimeCode = std::min( { startTimeCode, take.startTimeCode, take.endTimeCode } );
+		endTimeCode = std::max( { endTimeCode, take.startTimeCode, take.endTimeCode } );
+	}
+	// The payloads are passed the same window
+	startTimeCode = std::max( startTimeCode, m_options.startFrame.value_or( startTimeCode ) );
+	endTimeCode = std::max( startTimeCode, std::min( endTimeCode, m_options.endFrame.value_or( endTimeCode ) ) );
+	m_pseudoRoot->metadata[ SdfFieldKeys->StartTimeCode ] = VtValue( startTimeCode );
+	m_pseudoRoot->metadata[ SdfFieldKeys->EndTimeCode ] = VtValue( endTimeCode );
+	m_pseudoRoot->metadata[ SdfFieldKeys->TimeCodesPerSecond ] = VtValue( timeCodesPerSecond );
+	m_pseudoRoot->metadata[ SdfFieldKeys->FramesPerSecond ] = VtValue( timeCodesPerSecond );
+
+	const TfToken name( "ROOT" );
+	m_pseudoRoot->children.push_back( name );
+	m_pseudoRoot->metadata[ SdfFieldKeys->DefaultPrim ] = VtValue( name );
+
+	// The type, kind and everything below /ROOT comes from the payload of the selected variant
+	const SdfPath nodePath = rootPath.AppendChild( name );
+	Prim& newPrim = AddPrim( nodePath );
+	const TfToken& variantSetName = UsdFbxFileFormatArgumentTokens->take;
+	newPrim.metadata[ SdfFieldKeys->VariantSetNames ]
+		= VtValue( SdfStringListOp::CreateExplicit( { variantSetName.GetString() } ) );
+	newPrim.metadata[ SdfChildrenKeys->VariantSetChildren ] = VtValue( TfTokenVector{ variantSetName } );
+
+	Prim& variantSet = AddPrim( nodePath.AppendVariantSelection( variantSetName.GetString(), "" ) );
+	TfTokenVector variantNames;
+	std::set< std::string > usedNames;
+	std::string selection;
+	for( const TakeInfo& take : takes )
+	{
+		const std::string variantName = cleanName( take.name, usedNames );
+		usedNames.insert( variantName );
+		variantNames.emplace_back( variantName );
+		if( selection.empty() || take.name == m_options.take )
+		{
+			selection = variantName;
+		}
+
+		// Same file and arguments, minus the variants, plus the take. Resolved relative to this layer
+		SdfFileFormat::FileFormatArguments payloadArgs = args;
+		payloadArgs.erase( UsdFbxFileFormatArgumentTokens->takeVariants.GetString() );
+		payloadArgs[ UsdFbxFileFormatArgumentTokens->take.GetString() ] = take.name;
+		const std::string assetPath = SdfLayer::CreateIdentifier( "./" + fileName, payloadArgs );
+
+		Prim& variant = AddPrim( nodePath.AppendVariantSelection( variantSetName.GetString(), variantName ) );
+		variant.specifier = SdfSpecifierOver;
+		variant.metadata[ SdfFieldKeys->Payload ]
+			= VtValue( SdfPayloadListOp::CreateExplicit( { SdfPayload( assetPath, nodePath ) } ) );
+		TF_DEBUG( USDFBX ).Msg( "UsdFbx - Take variant \"%s\" -> @%s@\n", variantName.c_str(), assetPath.c_str() );
+	}
+	variantSet.metadata[ SdfChildrenKeys->VariantChildren ] = VtValue( variantNames );
+	newPrim.metadata[ SdfFieldKeys->VariantSelection ]
+		= VtValue( SdfVariantSelectionMap{ { variantSetName.GetString(), selection } } );
+}
+
+void remedy::UsdFbxDataReader::createValueClips(
+	const std::string& filePath,
+	const SdfFileFormat::FileFormatArguments& args,
+	double startTimeCode,
+	double endTimeCode )
+{
+	TRACE_FUNCTION()
+
+	// Everything keeps its default, the samples are provided by the clips
+	for( auto& [ primPath, prim ] : m_prims )
+	{
+		for( auto& [ propertyPath, property ] : prim.propertiesCache )
+		{
+			property.timeSamples.clear();
+			property.timeSampleSource.reset();
+		}
+	}
+
+	// Clips and manifest are the same file and arguments, resolved relative to this layer
+	const std::string assetPath = "./" + std::filesystem::path( filePath ).filename().generic_string();
+	SdfFileFormat::FileFormatArguments clipArgs = args;
+	clipArgs.erase( UsdFbxFileFormatArgumentTokens->clipFrames.GetString() );
+	SdfFileFormat::FileFormatArguments manifestArgs = clipArgs;
+	manifestArgs[ UsdFbxFileFormatArgumentTokens->clipManifest.GetString() ] = "1";
+	clipArgs[ UsdFbxFileFormatArgumentTokens->clip.GetString() ] = "1";
+
+	const double start = std::min( startTimeCode, endTimeCode );
+	const double end = std::max( startTimeCode, endTimeCode );
+	const auto clipFrames = static_cast< double >( m_options.clipFrames );
+	VtArray< SdfAssetPath > assetPaths;
+	VtVec2dArray active;
+	for( double clipStart = start; assetPaths.empty() || clipStart < end; clipStart += clipFrames )
+	{
+		// Clips overlap by one frame so values still interpolate across clip boundaries
+		const double clipEnd = std::min( clipStart + clipFrames, end );
+		clipArgs[ UsdFbxFileFormatArgumentTokens->startFrame.GetString() ] = TfStringify( clipStart );
+		clipArgs[ UsdFbxFileFormatArgumentTokens->endFrame.GetString() ] = TfStringify( clipEnd );
+		active.push_back( GfVec2d( clipStart, static_cast< double >( assetPaths.size() ) ) );
+		assetPaths.push_back( SdfAssetPath( SdfLayer::CreateIdentifier( assetPath, clipArgs ) ) );
+	}
+
+	// Clips carry the same absolute times as the take
+	VtVec2dArray times{ GfVec2d( start, start ) };
+	if( end > start )
+	{
+		times.push_back( GfVec2d( end, end ) );
+	}
+
+	const SdfPath rootPath = GetRootPath();
+	VtDictionary clipSet;
+	clipSet[ UsdClipsAPIInfoKeys->assetPaths.GetString() ] = VtValue( assetPaths );
+	clipSet[ UsdClipsAPIInfoKeys->primPath.GetString() ] = VtValue( rootPath.GetString() );
+	clipSet[ UsdClipsAPIInfoKeys->active.GetString() ] = VtValue( active );
+	clipSet[ UsdClipsAPIInfoKeys->times.GetString() ] = VtValue( times );
+	clipSet[ UsdClipsAPIInfoKeys->manifestAssetPath.GetString() ]
+		= VtValue( SdfAssetPath( SdfLayer::CreateIdentifier( assetPath, manifestArgs ) ) );
+
+	VtDictionary clips;
+	clips[ UsdClipsAPISetNames->default_.GetString() ] = VtValue( clipSet );
+	if( auto rootPrim = GetPrim( rootPath ) )
+	{
+		( *rootPrim )->metadata[ UsdTokens->clips ] = VtValue( clips );
+	}
+
+	TF_DEBUG( USDFBX ).Msg(
+		"UsdFbx - Presenting frames %g to %g as %zu value clips of %zu frames\n",
+		start,
+		end,
+		assetPaths.size(),
+		m_options.clipFrames );
+}
+
+void remedy::UsdFbxDataReader::keepAnimatedProperties( bool keepSamples )
+{
+	TRACE_FUNCTION()
+
+	for( auto& [ primPath, prim ] : m_prims )
+	{
+		for( auto it = prim.propertiesCache.begin(); it != prim.propertiesCache.end(); )
+		{
+			Property& property = it->second;
+			if( property.timeSamples.empty() && !property.timeSampleSource )
+			{
+				it = prim.propertiesCache.erase( it );
+				continue;
+			}
+
+			property.value = VtValue();
+			if( !keepSamples )
+			{
+				property.timeSamples.clear();
+				property.timeSampleSource.reset();
+			}
+			++it;
+		}
+		prim.propertyOrdering.reset();
+	}
+}
+
+void remedy::UsdFbxDataReader::readSequence(
+	const std::string& filePath,
+	const std::map< std::string, Property* >& sequencePoints,
+	double timeCodesPerSecond )
+{
+	TRACE_FUNCTION()
+
+	// Only the requested frame window is read
+	auto files = findSequenceFiles( filePath );
+	files.erase(
+		std::remove_if(
+			files.begin(),
+			files.end(),
+			[ & ]( const auto& file )
+			{
+				return ( m_options.startFrame && file.first < *m_options.startFrame )
+					   || ( m_options.endFrame && file.first > *m_options.endFrame );
+			} ),
+		files.end() );
+	if( files.empty() || sequencePoints.empty() )
+	{
+		TF_DEBUG( USDFBX ).Msg( "UsdFbx - No frames or meshes to read from the sequence of \"%s\"\n", filePath.c_str() );
+		return;
+	}
+
+	const double startTimeCode = files.front().first;
+	const double endTimeCode = files.back().first;
+	const size_t numFrames = files.size();
+	const auto sequence = std::make_shared< const FbxFileSequence >( std::move( files ), readSequenceFrame );
+	for( const auto& [ nodeNamePath, property ] : sequencePoints )
+	{
+		if( property == nullptr )
+		{
+			continue;
+		}
+		property->timeSampleSource = std::make_shared< FbxFileSequenceSamples >(
+			sequence,
+			nodeNamePath,
+			property->value.Get< VtVec3fArray >() );
+	}
+
+	// The frame numbers of the files are the time codes of the layer
+	m_pseudoRoot->metadata[ SdfFieldKeys->StartTimeCode ] = VtValue( startTimeCode );
+	m_pseudoRoot->metadata[ SdfFieldKeys->EndTimeCode ] = VtValue( endTimeCode );
+	m_pseudoRoot->metadata[ SdfFieldKeys->TimeCodesPerSecond ] = VtValue( timeCodesPerSecond );
+	m_pseudoRoot->metadata[ SdfFieldKeys->FramesPerSecond ] = VtValue( timeCodesPerSecond );
+
+	TF_DEBUG( USDFBX ).Msg(
+		"UsdFbx - Reading %zu meshes from a sequence of %zu files, frames %g to %g\n",
+		sequencePoints.size(),
+		numFrames,
+		startTimeCode,
+		endTimeCode );
+}
+
+void remedy::UsdFbxDataReader::reportSampleCounts() const
+{
+	if( !TfDebug::IsEnabled( USDFBX_PERF ) )
+	{
+		return;
+	}
+
+	size_t numProperties = 0;
+	size_t numAnimatedProperties = 0;
+	size_t numTimeSamples = 0;
+	for( const auto& [ primPath, prim ] : m_prims )
+	{
+		for( const auto& [ propertyPath, property ] : prim.propertiesCache )
+		{
+			const size_t numPropertySamples
+				= property.timeSampleSource ? property.timeSampleSource->GetTimes().size() : property.timeSamples.size();
+			++numProperties;
+			numAnimatedProperties += numPropertySamples > 0 ? 1 : 0;
+			numTimeSamples += numPropertySamples;
+		}
+	}
+
+	TF_DEBUG( USDFBX_PERF )
+		.Msg(
+			"UsdFbx - %zu prims, %zu properties of which %zu animated, %zu time samples\n",
+			m_prims.size(),
+			numProperties,
+			numAnimatedProperties,
+			numTimeSamples );
+}
+
 std::string remedy::UsdFbxDataReader::GetErrors() const
 {
 	return m_errorLog;
@@ -667,7 +1522,7 @@ bool remedy::UsdFbxDataReader::HasSpec( const SdfPath& path ) const
 {
 	if( auto prim = GetPrim( path ) )
 	{
-		return path.IsAbsoluteRootOrPrimPath() || GetProperty( *prim.value(), path );
+		return isPrimOrVariantPath( path ) || GetProperty( *prim.value(), path );
 	}
 	return false;
 }
@@ -679,6 +1534,10 @@ SdfSpecType remedy::UsdFbxDataReader::GetSpecType( const SdfPath& path ) const
 	{
 		return SdfSpecTypeUnknown;
 	}
+	if( path.IsPrimVariantSelectionPath() )
+	{
+		return isVariantSetPath( path ) ? SdfSpecTypeVariantSet : SdfSpecTypeVariant;
+	}
 	if( !path.IsAbsoluteRootOrPrimPath() )
 	{
 		if( const auto& prop = GetProperty( *prim.value(), path ) )
@@ -726,7 +1585,7 @@ bool remedy::UsdFbxDataReader::Has( const SdfPath& path, const TfToken& fieldNam
 {
 	if( auto prim = GetPrim( path ) )
 	{
-		if( !path.IsAbsoluteRootOrPrimPath() )
+		if( !isPrimOrVariantPath( path ) )
 		{
 			if( auto prop = GetProperty( *prim.value(), path ) )
 			{
@@ -737,7 +1596,8 @@ bool remedy::UsdFbxDataReader::Has( const SdfPath& path, const TfToken& fieldNam
 		}
 		else
 		{
-			return getPrimFieldValue( prim.value(), prim.value() == m_pseudoRoot, fieldName, value );
+			// Variant sets only carry their variant children, same as the pseudo-root only carries prim children
+			return getPrimFieldValue( prim.value(), prim.value() == m_pseudoRoot || isVariantSetPath( path ), fieldName, value );
 		}
 	}
 	return false;
@@ -754,13 +1614,13 @@ TfTokenVector remedy::UsdFbxDataReader::List( const SdfPath& path ) const
 
 	const auto prim = *primRes;
 
-	if( !path.IsAbsoluteRootOrPrimPath() )
+	if( !isPrimOrVariantPath( path ) )
 	{
 		if( const auto prop = GetProperty( *prim, path ) )
 		{
 			result.push_back( SdfFieldKeys->Custom );
 			result.push_back( SdfFieldKeys->Variability );
-			if( !( *prop )->timeSamples.empty() )
+			if( !( *prop )->timeSamples.empty() || ( *prop )->timeSampleSource )
 			{
 				result.push_back( SdfFieldKeys->TimeSamples );
 			}
@@ -781,7 +1641,7 @@ TfTokenVector remedy::UsdFbxDataReader::List( const SdfPath& path ) const
 	}
 	else
 	{
-		if( prim != m_pseudoRoot )
+		if( prim != m_pseudoRoot && !isVariantSetPath( path ) )
 		{
 			if( !prim->typeName.IsEmpty() )
 			{
@@ -824,6 +1684,12 @@ std::set< double > remedy::UsdFbxDataReader::ListAllTimeSamples() const
 	{
 		for( const auto& [ propPath, prop ] : prim.propertiesCache )
 		{
+			if( prop.timeSampleSource )
+			{
+				const auto& times = prop.timeSampleSource->GetTimes();
+				result.insert( times.cbegin(), times.cend() );
+				continue;
+			}
 			std::transform(
 				prop.timeSamples.cbegin(),
 				prop.timeSamples.cend(),
@@ -846,6 +1712,11 @@ std::set< double > remedy::UsdFbxDataReader::ListTimeSamplesForPath( const SdfPa
 	{
 		if( const auto property = GetProperty( *prim.value(), path ) )
 		{
+			if( ( *property )->timeSampleSource )
+			{
+				const auto& times = ( *property )->timeSampleSource->GetTimes();
+				return { times.cbegin(), times.cend() };
+			}
 			std::transform(
 				( *property )->timeSamples.cbegin(),
 				( *property )->timeSamples.cend(),
@@ -868,7 +1739,7 @@ remedy::UsdFbxDataReader::Prim& remedy::UsdFbxDataReader::AddPrim( const SdfPath
 
 std::optional< const remedy::UsdFbxDataReader::Prim* > remedy::UsdFbxDataReader::GetPrim( const SdfPath& path ) const
 {
-	const auto it = m_prims.find( path.IsAbsoluteRootPath() ? path : path.GetPrimPath() );
+	const auto it = m_prims.find( getPrimOrVariantPath( path ) );
 	if( it == m_prims.end() )
 	{
 		return std::nullopt;
@@ -878,7 +1749,7 @@ std::optional< const remedy::UsdFbxDataReader::Prim* > remedy::UsdFbxDataReader:
 
 std::optional< remedy::UsdFbxDataReader::Prim* > remedy::UsdFbxDataReader::GetPrim( const SdfPath& path )
 {
-	const auto it = m_prims.find( path.GetPrimPath() );
+	const auto it = m_prims.find( getPrimOrVariantPath( path ) );
 	if( it == m_prims.end() )
 	{
 		return std::nullopt;
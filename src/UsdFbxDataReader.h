@@ -6,6 +6,8 @@
 #include <pxr/usd/sdf/abstractData.h>
 #include <pxr/usd/sdf/fileFormat.h>
 #include <pxr/usd/usd/timeCode.h>
+#include <memory>
+#include <optional>
 #include <string>
 
 PXR_NAMESPACE_USING_DIRECTIVE
@@ -46,6 +48,84 @@ namespace remedy
 		/// An optional ordering of name children or properties.
 		using Ordering = std::optional< TfTokenVector >;
 
+		/// Options parsed from the layer's file format arguments.
+		struct Options
+		{
+			/// Store SkelAnimation translations/rotations quantized, decoding frames on request.
+			bool quantizeSkelAnimation = false;
+
+			/// Name of the take (FbxAnimStack) to convert, the first one in the file when empty.
+			std::string take;
+
+			/// Expose every take as a variant of a "take" variant set on /ROOT instead of converting the scene.
+			/// Each variant payloads the same file with the take argument set.
+			bool takeVariants = false;
+
+			/// Window of the take to sample, in frames. Unbounded when not set.
+			std::optional< double > startFrame;
+			std::optional< double > endFrame;
+
+			/// Present the take as value clips of this many frames each. /ROOT carries the clip metadata,
+			/// the clips and the manifest are the same file opened with the clip/clipManifest arguments.
+			/// The scene is imported once and kept in memory for as long as this layer is open, the clips and the
+			/// manifest are converted from it instead of importing the file again each.
+			size_t clipFrames = 0;
+
+			/// Serve a single clip, only the time samples of animated properties are kept.
+			bool clip = false;
+
+			/// Serve the clip manifest, only the declarations of animated properties are kept.
+			bool clipManifest = false;
+
+			/// Write static transforms as a single xformOp:transform, and nothing at all for identity transforms.
+			/// Animated transforms keep their decomposed, UsdGeomXformCommonAPI compatible xformOps.
+			bool collapseStaticXforms = false;
+
+			/// Keep at most this many influences per skinned control point, the largest ones. 0 keeps all of them.
+			size_t maxInfluences = 0;
+
+			/// Drop the influences of a skinned control point whose normalized weight is below this.
+			float minWeight = 0.0f;
+
+			/// Deform skinned meshes every frame into time sampled points and normals, instead of binding them to their Skeleton.
+			bool bakeSkinning = false;
+
+			/// Read the file as the first frame of a numbered sequence of files (mesh_0001.fbx, mesh_0002.fbx, ...).
+			/// The mesh points of every frame are read from its file on request.
+			bool sequence = false;
+
+			/// Draw the static leaf nodes sharing meshes under a parent with one UsdGeomPointInstancer instead of a prim each
+			bool pointInstancer = false;
+
+			/// Bake the world transform of static meshes into their points and merge the ones sharing materials
+			bool mergeStatic = false;
+
+			/// Leave out nulls that only group their children: identity transform, visible, no animation or user properties
+			bool flattenNulls = false;
+		};
+
+		/// A take as listed in the file header, readable without importing the scene.
+		struct TakeInfo
+		{
+			std::string name;
+			double startTimeCode = 0.0;
+			double endTimeCode = 0.0;
+		};
+
+		/// Time samples that are produced on request rather than stored as VtValues up front.
+		/// Implementations must be safe to query from multiple threads.
+		class TimeSampleSource
+		{
+		public:
+			virtual ~TimeSampleSource() = default;
+
+			/// Sorted list of all the times a sample exists for.
+			[[nodiscard]] virtual const std::vector< double >& GetTimes() const = 0;
+
+			/// Fetch the sample at \p time. Returns \c false if there is no sample at that exact time.
+			[[nodiscard]] virtual bool Get( double time, VtValue* value ) const = 0;
+		};
+
 		/// Property cache.
 		struct Property
 		{
@@ -53,6 +133,8 @@ namespace remedy
 			SdfValueTypeName typeName = SdfValueTypeNames->Token;
 			MetadataMap metadata = {};
 			std::vector< std::tuple< UsdTimeCode, VtValue > > timeSamples = {};
+			// Used instead of timeSamples when set
+			std::shared_ptr< const TimeSampleSource > timeSampleSource = nullptr;
 			std::vector< SdfPath > targetPaths = {};
 			SdfVariability variability = SdfVariabilityVarying;
 			VtValue value;
@@ -75,12 +157,12 @@ namespace remedy
 			Ordering propertyOrdering;
 			MetadataMap metadata;
 			PropertyMap propertiesCache;
-			SdfPath prototype; // Path to prototype; only set on instances, currently unused
+			SdfPath prototype; // Path to prototype, served as an internal reference
 		};
 
 		// Basic interface with UsdSdfAbstractData
 		UsdFbxDataReader() = default;
-		~UsdFbxDataReader() = default;
+		~UsdFbxDataReader();
 
 		UsdFbxDataReader( const UsdFbxDataReader& ) = delete;
 		UsdFbxDataReader& operator=( const UsdFbxDataReader& ) = delete;
@@ -137,10 +219,44 @@ namespace remedy
 
 		[[nodiscard]] SdfPath GetRootPath() const;
 
+		[[nodiscard]] const Options& GetOptions() const
+		{
+			return m_options;
+		}
+
 	private:
+		void createTakeVariants(
+			const std::string& filePath,
+			const SdfFileFormat::FileFormatArguments& args,
+			const std::vector< TakeInfo >& takes,
+			double timeCodesPerSecond );
+
+		void createValueClips(
+			const std::string& filePath,
+			const SdfFileFormat::FileFormatArguments& args,
+			double startTimeCode,
+			double endTimeCode );
+
+		/// Drops every property without time samples. When \p keepSamples is \c false the animated
+		/// properties are reduced to their declaration.
+		void keepAnimatedProperties( bool keepSamples );
+
+		/// Serves the points of every mesh in \p sequencePoints from the other files of the sequence \p filePath is
+		/// the first frame of
+		void readSequence(
+			const std::string& filePath,
+			const std::map< std::string, Property* >& sequencePoints,
+			double timeCodesPerSecond );
+
+		/// Reports how many properties got sampled under USDFBX_PERF
+		void reportSampleCounts() const;
+
 		std::string m_errorLog;
+		Options m_options;
 		using PrimMap = std::map< SdfPath, Prim >;
 		PrimMap m_prims;
 		Prim* m_pseudoRoot = nullptr;
+		/// The FbxScene the value clips of this layer are converted from
+		std::shared_ptr< void > m_clipScene;
 	};
 } // namespace remedy
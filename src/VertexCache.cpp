@@ -0,0 +1,381 @@
+// Copyright (C) Remedy Entertainment Plc.
+
+#include "VertexCache.h"
+
+#include "PrecompiledHeader.h"
+
+DIAGNOSTIC_PUSH
+IGNORE_USD_WARNINGS
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/work/loops.h>
+DIAGNOSTIC_POP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace
+{
+	constexpr size_t PC2_HEADER_SIZE = 32;
+	constexpr double MAYA_TICKS_PER_SECOND = 6000.0;
+
+	// Scene frames closer than this to a cache frame are not interpolated
+	constexpr double FRAME_WEIGHT_EPSILON = 1e-4;
+
+	uint32_t readUInt32LittleEndian( const char* data )
+	{
+		const auto* bytes = reinterpret_cast< const unsigned char* >( data );
+		return static_cast< uint32_t >( bytes[ 0 ] ) | ( static_cast< uint32_t >( bytes[ 1 ] ) << 8 )
+			   | ( static_cast< uint32_t >( bytes[ 2 ] ) << 16 ) | ( static_cast< uint32_t >( bytes[ 3 ] ) << 24 );
+	}
+
+	uint32_t readUInt32BigEndian( const char* data )
+	{
+		const auto* bytes = reinterpret_cast< const unsigned char* >( data );
+		return ( static_cast< uint32_t >( bytes[ 0 ] ) << 24 ) | ( static_cast< uint32_t >( bytes[ 1 ] ) << 16 )
+			   | ( static_cast< uint32_t >( bytes[ 2 ] ) << 8 ) | static_cast< uint32_t >( bytes[ 3 ] );
+	}
+
+	float readFloatLittleEndian( const char* data )
+	{
+		const uint32_t bits = readUInt32LittleEndian( data );
+		float value;
+		std::memcpy( &value, &bits, sizeof( value ) );
+		return value;
+	}
+
+	float readFloatBigEndian( const char* data )
+	{
+		const uint32_t bits = readUInt32BigEndian( data );
+		float value;
+		std::memcpy( &value, &bits, sizeof( value ) );
+		return value;
+	}
+
+	/// Points are single precision in USD, double caches are narrowed as they are read
+	float readDoubleBigEndian( const char* data )
+	{
+		const uint64_t bits = ( static_cast< uint64_t >( readUInt32BigEndian( data ) ) << 32 ) | readUInt32BigEndian( data + 4 );
+		double value;
+		std::memcpy( &value, &bits, sizeof( value ) );
+		return static_cast< float >( value );
+	}
+
+	/// Maya times are signed ticks
+	double readMayaSeconds( const char* data )
+	{
+		return static_cast< int32_t >( readUInt32BigEndian( data ) ) / MAYA_TICKS_PER_SECOND;
+	}
+
+	bool hasTag( const char* data, const char* tag )
+	{
+		return std::memcmp( data, tag, 4 ) == 0;
+	}
+
+	/// IFF chunks start on 4 byte boundaries
+	size_t alignChunk( size_t offset )
+	{
+		return ( offset + 3 ) & ~size_t( 3 );
+	}
+} // namespace
+
+bool remedy::VertexCache::mapFile( const std::string& path )
+{
+	std::string error;
+	ArchConstFileMapping mapping = ArchMapFileReadOnly( path, &error );
+	if( !mapping )
+	{
+		TF_WARN( "Unable to map vertex cache \"%s\": %s", path.c_str(), error.c_str() );
+		return false;
+	}
+	m_files.push_back( std::move( mapping ) );
+	return true;
+}
+
+std::shared_ptr< const remedy::VertexCache > remedy::VertexCache::OpenPc2( const std::string& path, double framesPerSecond )
+{
+	TRACE_FUNCTION()
+
+	auto cache = std::make_shared< VertexCache >();
+	if( !cache->mapFile( path ) )
+	{
+		return nullptr;
+	}
+
+	const char* data = cache->m_files[ 0 ].get();
+	const size_t length = ArchGetFileMappingLength( cache->m_files[ 0 ] );
+	if( length < PC2_HEADER_SIZE || std::memcmp( data, "POINTCACHE2", 12 ) != 0 )
+	{
+		TF_WARN( "\"%s\" is not a PC2 point cache", path.c_str() );
+		return nullptr;
+	}
+
+	const size_t numPoints = readUInt32LittleEndian( data + 16 );
+	const float startFrame = readFloatLittleEndian( data + 20 );
+	const float sampleRate = readFloatLittleEndian( data + 24 );
+	const size_t numSamples = readUInt32LittleEndian( data + 28 );
+	const size_t frameSize = numPoints * 3 * sizeof( float );
+	if( length < PC2_HEADER_SIZE + numSamples * frameSize )
+	{
+		TF_WARN( "PC2 point cache \"%s\" is truncated", path.c_str() );
+		return nullptr;
+	}
+
+	cache->m_numPoints = numPoints;
+	cache->m_frames.reserve( numSamples );
+	for( size_t sample = 0; sample < numSamples; ++sample )
+	{
+		cache->m_frames.push_back(
+			{ ( startFrame + static_cast< double >( sample ) * sampleRate ) / framesPerSecond,
+			  0,
+			  PC2_HEADER_SIZE + sample * frameSize,
+			  Encoding::FloatLittleEndian } );
+	}
+	return cache;
+}
+
+std::shared_ptr< const remedy::VertexCache > remedy::VertexCache::OpenMayaCache(
+	const std::vector< std::string >& paths,
+	const std::string& channel )
+{
+	TRACE_FUNCTION()
+
+	auto cache = std::make_shared< VertexCache >();
+	std::string channelName = channel;
+	for( const std::string& path : paths )
+	{
+		if( !cache->mapFile( path ) )
+		{
+			continue;
+		}
+
+		// Files are groups of chunks. A CACH group holds the time of caches with one file per frame, every MYCH group
+		// holds the channels of one frame. Only the headers are read here, the points are decoded in ReadFrame
+		const size_t fileIndex = cache->m_files.size() - 1;
+		const char* data = cache->m_files.back().get();
+		const size_t length = ArchGetFileMappingLength( cache->m_files.back() );
+		double headerSeconds = 0.0;
+		for( size_t group = 0; group + 12 <= length; )
+		{
+			if( hasTag( data + group, "FOR8" ) )
+			{
+				TF_WARN( "\"%s\" is a 64 bit Maya cache, which is not supported", path.c_str() );
+				return nullptr;
+			}
+
+			const size_t groupEnd = group + 8 + readUInt32BigEndian( data + group + 4 );
+			if( !hasTag( data + group, "FOR4" ) || groupEnd > length )
+			{
+				TF_WARN( "\"%s\" is not a valid Maya cache", path.c_str() );
+				break;
+			}
+
+			const bool isHeader = hasTag( data + group + 8, "CACH" );
+			const bool isFrame = hasTag( data + group + 8, "MYCH" );
+			double seconds = headerSeconds;
+			std::string chunkChannelName;
+			size_t numElements = 0;
+			for( size_t chunk = group + 12; chunk + 8 <= groupEnd; )
+			{
+				const char* tag = data + chunk;
+				const size_t size = readUInt32BigEndian( data + chunk + 4 );
+				const size_t payload = chunk + 8;
+				if( payload + size > groupEnd )
+				{
+					break;
+				}
+
+				if( isHeader && hasTag( tag, "STIM" ) )
+				{
+					headerSeconds = readMayaSeconds( data + payload );
+				}
+				else if( isFrame && hasTag( tag, "TIME" ) )
+				{
+					seconds = readMayaSeconds( data + payload );
+				}
+				else if( isFrame && hasTag( tag, "CHNM" ) )
+				{
+					chunkChannelName.assign( data + payload, strnlen( data + payload, size ) );
+				}
+				else if( isFrame && hasTag( tag, "SIZE" ) )
+				{
+					numElements = readUInt32BigEndian( data + payload );
+				}
+				else if( isFrame && ( hasTag( tag, "FVCA" ) || hasTag( tag, "DVCA" ) ) )
+				{
+					const bool isDouble = hasTag( tag, "DVCA" );
+					const size_t componentSize = isDouble ? sizeof( double ) : sizeof( float );
+					if( channelName.empty() )
+					{
+						channelName = chunkChannelName;
+					}
+					if( chunkChannelName == channelName && size >= numElements * 3 * componentSize
+						&& ( cache->m_frames.empty() || numElements == cache->m_numPoints ) )
+					{
+						cache->m_numPoints = numElements;
+						cache->m_frames.push_back(
+							{ seconds, fileIndex, payload, isDouble ? Encoding::DoubleBigEndian : Encoding::FloatBigEndian } );
+					}
+				}
+				chunk = alignChunk( payload + size );
+			}
+			group = alignChunk( groupEnd );
+		}
+	}
+
+	if( cache->m_frames.empty() )
+	{
+		TF_WARN( "Unable to find any frame of channel \"%s\" in Maya cache", channelName.c_str() );
+		return nullptr;
+	}
+
+	// Caches with one file per frame do not have to be listed in time order
+	std::stable_sort(
+		cache->m_frames.begin(),
+		cache->m_frames.end(),
+		[]( const Frame& a, const Frame& b ) { return a.seconds < b.seconds; } );
+	cache->m_frames.erase(
+		std::unique(
+			cache->m_frames.begin(),
+			cache->m_frames.end(),
+			[]( const Frame& a, const Frame& b ) { return a.seconds == b.seconds; } ),
+		cache->m_frames.end() );
+	return cache;
+}
+
+VtVec3fArray remedy::VertexCache::ReadFrame( size_t frameIndex ) const
+{
+	TRACE_FUNCTION()
+
+	const Frame& frame = m_frames[ frameIndex ];
+	const char* data = m_files[ frame.file ].get() + frame.offset;
+	VtVec3fArray points( m_numPoints );
+	GfVec3f* pointsData = points.data();
+	auto decode = [ & ]( auto readComponent, size_t componentSize )
+	{
+		WorkParallelForN(
+			m_numPoints,
+			[ & ]( size_t begin, size_t end )
+			{
+				for( size_t point = begin; point < end; ++point )
+				{
+					const char* p = data + point * 3 * componentSize;
+					pointsData[ point ] = GfVec3f(
+						readComponent( p ),
+						readComponent( p + componentSize ),
+						readComponent( p + 2 * componentSize ) );
+				}
+			} );
+	};
+
+	switch( frame.encoding )
+	{
+	case Encoding::FloatLittleEndian:
+		decode( readFloatLittleEndian, sizeof( float ) );
+		break;
+	case Encoding::FloatBigEndian:
+		decode( readFloatBigEndian, sizeof( float ) );
+		break;
+	case Encoding::DoubleBigEndian:
+		decode( readDoubleBigEndian, sizeof( double ) );
+		break;
+	}
+	return points;
+}
+
+remedy::VertexCacheSamples::VertexCacheSamples(
+	std::shared_ptr< const VertexCache > cache,
+	std::vector< double > times,
+	std::vector< double > seconds,
+	const GfMatrix4d& geometryToNode )
+	: m_cache( std::move( cache ) )
+	, m_times( std::move( times ) )
+	, m_seconds( std::move( seconds ) )
+	, m_geometryToNode( geometryToNode )
+	, m_hasGeometryTransform( geometryToNode != GfMatrix4d( 1.0 ) )
+	, m_frameCache( TfStringPrintf( "%zu vertex cache points", m_cache->GetNumPoints() ) )
+{
+}
+
+const std::vector< double >& remedy::VertexCacheSamples::GetTimes() const
+{
+	return m_times;
+}
+
+VtVec3fArray remedy::VertexCacheSamples::readFrame( size_t frameIndex ) const
+{
+	return m_frameCache.Get( frameIndex, [ this ]( size_t frame ) { return m_cache->ReadFrame( frame ); } );
+}
+
+bool remedy::VertexCacheSamples::Get( double time, VtValue* value ) const
+{
+	const auto timeIt = std::lower_bound( m_times.cbegin(), m_times.cend(), time );
+	if( timeIt == m_times.cend() || *timeIt != time )
+	{
+		return false;
+	}
+
+	if( value == nullptr )
+	{
+		return true;
+	}
+
+	TRACE_FUNCTION()
+
+	// Scene frames before or after the cache hold on to its first or last frame
+	const double seconds = m_seconds[ static_cast< size_t >( std::distance( m_times.cbegin(), timeIt ) ) ];
+	size_t numEarlierFrames = 0;
+	for( size_t upper = m_cache->GetNumFrames(); numEarlierFrames < upper; )
+	{
+		const size_t middle = ( numEarlierFrames + upper ) / 2;
+		if( m_cache->GetFrameSeconds( middle ) <= seconds )
+		{
+			numEarlierFrames = middle + 1;
+		}
+		else
+		{
+			upper = middle;
+		}
+	}
+	const size_t frame = numEarlierFrames > 0 ? numEarlierFrames - 1 : 0;
+	const size_t nextFrame = std::min( numEarlierFrames, m_cache->GetNumFrames() - 1 );
+
+	double weight = 0.0;
+	if( nextFrame > frame )
+	{
+		weight = ( seconds - m_cache->GetFrameSeconds( frame ) )
+				 / ( m_cache->GetFrameSeconds( nextFrame ) - m_cache->GetFrameSeconds( frame ) );
+	}
+
+	VtVec3fArray points = readFrame( weight > 1.0 - FRAME_WEIGHT_EPSILON ? nextFrame : frame );
+	const bool isInterpolated = weight > FRAME_WEIGHT_EPSILON && weight < 1.0 - FRAME_WEIGHT_EPSILON;
+	if( isInterpolated || m_hasGeometryTransform )
+	{
+		const VtVec3fArray nextPoints = isInterpolated ? readFrame( nextFrame ) : VtVec3fArray();
+		const auto t = static_cast< float >( weight );
+		GfVec3f* pointsData = points.data();
+		WorkParallelForN(
+			points.size(),
+			[ & ]( size_t begin, size_t end )
+			{
+				for( size_t point = begin; point < end; ++point )
+				{
+					if( isInterpolated )
+					{
+						pointsData[ point ] += ( nextPoints[ point ] - pointsData[ point ] ) * t;
+					}
+					if( m_hasGeometryTransform )
+					{
+						pointsData[ point ] = GfVec3f( m_geometryToNode.Transform( pointsData[ point ] ) );
+					}
+				}
+			} );
+	}
+
+	*value = VtValue( std::move( points ) );
+	return true;
+}
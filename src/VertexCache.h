@@ -0,0 +1,107 @@
+// Copyright (C) Remedy Entertainment Plc.
+
+#pragma once
+
+#include "TimeSampleCache.h"
+#include "UsdFbxDataReader.h"
+
+#include <pxr/base/arch/fileSystem.h>
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/pxr.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace remedy
+{
+	/// Control point positions of a mesh stored in external point cache files, 3ds Max PC2 or Maya MC.
+	///
+	/// The cache files are memory mapped and only their headers are walked when they are opened, to find where the
+	/// points of every frame start. A frame is decoded when it is read and nothing else is kept in memory, caches far
+	/// larger than the available memory can be played back.
+	class VertexCache
+	{
+	public:
+		/// Opens a PC2 file, its sample frames are numbered at \p framesPerSecond.
+		/// Returns nullptr when the file cannot be read.
+		static std::shared_ptr< const VertexCache > OpenPc2( const std::string& path, double framesPerSecond );
+
+		/// Opens the .mc data files of a Maya cache and reads \p channel from them, or the first channel found when
+		/// \p channel is empty. 64 bit (FOR8) caches are not supported. Returns nullptr when no frame could be found.
+		static std::shared_ptr< const VertexCache > OpenMayaCache(
+			const std::vector< std::string >& paths,
+			const std::string& channel );
+
+		[[nodiscard]] size_t GetNumPoints() const
+		{
+			return m_numPoints;
+		}
+
+		[[nodiscard]] size_t GetNumFrames() const
+		{
+			return m_frames.size();
+		}
+
+		[[nodiscard]] double GetFrameSeconds( size_t frameIndex ) const
+		{
+			return m_frames[ frameIndex ].seconds;
+		}
+
+		[[nodiscard]] VtVec3fArray ReadFrame( size_t frameIndex ) const;
+
+	private:
+		enum class Encoding
+		{
+			FloatLittleEndian,
+			FloatBigEndian,
+			DoubleBigEndian
+		};
+
+		struct Frame
+		{
+			double seconds;
+			size_t file;
+			size_t offset;
+			Encoding encoding;
+		};
+
+		bool mapFile( const std::string& path );
+
+		std::vector< ArchConstFileMapping > m_files;
+		std::vector< Frame > m_frames;
+		size_t m_numPoints = 0;
+	};
+
+	/// Serves the frames of a VertexCache as the time samples of a points attribute. Scene frames that fall between
+	/// two cache frames are interpolated linearly. Only the last few decoded cache frames are kept around.
+	class VertexCacheSamples : public UsdFbxDataReader::TimeSampleSource
+	{
+	public:
+		/// \p times are the time codes of the scene frames and \p seconds the matching times in the cache.
+		/// \p geometryToNode takes the cached points into the space of the mesh prim.
+		VertexCacheSamples(
+			std::shared_ptr< const VertexCache > cache,
+			std::vector< double > times,
+			std::vector< double > seconds,
+			const GfMatrix4d& geometryToNode );
+
+		[[nodiscard]] const std::vector< double >& GetTimes() const override;
+		[[nodiscard]] bool Get( double time, VtValue* value ) const override;
+
+	private:
+		VtVec3fArray readFrame( size_t frameIndex ) const;
+
+		std::shared_ptr< const VertexCache > m_cache;
+		std::vector< double > m_times;
+		std::vector< double > m_seconds;
+		GfMatrix4d m_geometryToNode;
+		bool m_hasGeometryTransform;
+
+		// Decoded cache frames
+		mutable TimeSampleCache< VtVec3fArray > m_frameCache;
+	};
+} // namespace remedy
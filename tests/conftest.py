@@ -10,13 +10,30 @@ load_dotenv(
 )
 
 import FbxCommon as fbx
-from pxr import Usd, Plug, Gf, UsdGeom
+from pxr import Usd, Plug, Gf, UsdGeom, Tf
 
 from data import TransformableNode, scenebuilder, MappedCoordinates, Mesh
 
 from helpers import create_FbxTime
 
 
+def pytest_addoption(parser):
+    parser.addoption("--benchmarks", action="store_true", default=False, help="run the timing benchmarks")
+
+
+def pytest_configure(config):
+    config.addinivalue_line("markers", "benchmark: timing comparison, only runs with --benchmarks")
+
+
+def pytest_collection_modifyitems(config, items):
+    if config.getoption("--benchmarks"):
+        return
+    skip_benchmark = pytest.mark.skip(reason="benchmarks only run with --benchmarks")
+    for item in items:
+        if "benchmark" in item.keywords:
+            item.add_marker(skip_benchmark)
+
+
 @pytest.fixture
 def root_prim_name():
     yield "ROOT"
@@ -123,6 +140,16 @@ def registry():
     yield reg
 
 
+@pytest.fixture
+def usdfbx_debug(registry):
+    plugin = registry.GetPluginWithName("usdFbx")
+    if not plugin.isLoaded:
+        plugin.Load()
+    Tf.Debug.SetDebugSymbolsByName("USDFBX", 1)
+    yield
+    Tf.Debug.SetDebugSymbolsByName("USDFBX", 0)
+
+
 @pytest.fixture(scope="session")
 def fbx_sdk_objects():
     return fbx.InitializeSdkObjects()
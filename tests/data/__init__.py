@@ -75,7 +75,9 @@ class Settings:
     axis: fbx.FbxAxisSystem = fbx.FbxAxisSystem.MayaYUp
     original_axis: fbx.FbxAxisSystem = None
     units: fbx.FbxSystemUnit = fbx.FbxSystemUnit.cm
+    original_units: fbx.FbxSystemUnit = None
     anim_layers: Tuple[str, ...] = ()
+    anim_stacks: Tuple[str, ...] = ("RootStack",)  # Every stack gets all anim_layers, the first one is current
 
 
 @dataclass
@@ -93,6 +95,7 @@ class Transform:
 class AnimationCurve:
     name: str = ""
     anim_layer: str = ""
+    anim_stack: str = ""  # Current animation stack when empty
     times: List[fbx.FbxTime] = field(default_factory=list)
     values: List[Union[float, Vec3_t, Vec4_t]] = field(default_factory=list)
 
@@ -198,6 +201,14 @@ class PhongMaterial(LambertMaterial):
     reflection_factor: float = 0.0
 
 
+@dataclass
+class BlendShapeChannel(Node):
+    # Full positions of every control point per target shape, in-betweens first and the full target last
+    targets: List[List[Vec3_t]] = field(default_factory=list)
+    # DeformPercent at which each target is reached
+    full_weights: List[float] = field(default_factory=list)
+
+
 @dataclass
 class Mesh(TransformableNode):
     # List of vec3 vertex positions
@@ -215,6 +226,11 @@ class Mesh(TransformableNode):
         fbx.FbxLayerElement.EReferenceMode.eIndexToDirect
     )
     skinbinding: Tuple[SkinBinding, ...] = ()
+    blendshapes: Tuple[BlendShapeChannel, ...] = ()
+    # PC2 point cache deforming the mesh
+    vertex_cache: pathlib.Path = None
+    # Mesh node whose mesh attribute this node shares, its own points and polygons are ignored
+    instance_of: "Mesh" = None
     materials: List[Tuple[Union[LambertMaterial, PhongMaterial], int]] = field(
         default_factory=list
     )
@@ -23,6 +23,9 @@ def apply_transform(node, transform: Transform):
 
 def create_animation_curve(scene, fbx_prop, anim_curve: AnimationCurve):
     anim_stack = scene.GetCurrentAnimationStack()
+    if anim_curve.anim_stack:
+        anim_stack = scene.FindMember(fbx.FbxAnimStack.ClassId, anim_curve.anim_stack)
+    assert anim_stack is not None
     anim_layer = anim_stack.FindMember(fbx.FbxAnimLayer.ClassId, anim_curve.anim_layer)
     assert anim_layer is not None
     curve_node = fbx_prop.CreateCurveNode(anim_layer)
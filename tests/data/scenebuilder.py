@@ -39,15 +39,19 @@ class Builder:
         
         if self.settings.original_axis is not None:
             settings.SetOriginalUpAxis(self.settings.original_axis)
+        if self.settings.original_units is not None:
+            settings.SetOriginalSystemUnit(self.settings.original_units)
 
         if self.settings.anim_layers:
-            anim_stack = fbx.FbxAnimStack.Create(self.scene, "RootStack")
-            self.scene.SetCurrentAnimationStack(anim_stack)
+            anim_stacks = [
+                fbx.FbxAnimStack.Create(self.scene, stack_name)
+                for stack_name in self.settings.anim_stacks
+            ]
+            self.scene.SetCurrentAnimationStack(anim_stacks[0])
 
-        for anim_layer in self.settings.anim_layers:
-            self.scene.GetCurrentAnimationStack().AddMember(
-                fbx.FbxAnimLayer.Create(self.scene, anim_layer)
-            )
+            for anim_stack in anim_stacks:
+                for anim_layer in self.settings.anim_layers:
+                    anim_stack.AddMember(fbx.FbxAnimLayer.Create(self.scene, anim_layer))
 
         root_joint_nodes = [
             node for node in self.nodes if type(node) is Joint and node.is_root
@@ -65,6 +69,11 @@ class Builder:
 
             node_to_fbx_map[node] = fbx_node
 
+        # Nodes instancing another mesh share its attribute instead of their own
+        for node, fbx_node in node_to_fbx_map.items():
+            if type(node) is Mesh and node.instance_of is not None:
+                fbx_node.SetNodeAttribute(node_to_fbx_map[node.instance_of].GetNodeAttribute())
+
         # Second pass, reparent where needed
         for node, fbx_node in node_to_fbx_map.items():
             if node.parent is None:
@@ -123,6 +132,41 @@ class Builder:
             fbx_node.GetNodeAttribute().AddDeformer(skin)
             self.scene.AddPose(bind_pose)
             self.scene.AddPose(rest_pose)
+
+        # Fourth pass, blend shapes
+        for node, fbx_node in node_to_fbx_map.items():
+            if type(node) is not Mesh or not node.blendshapes:
+                continue
+
+            blend_shape = fbx.FbxBlendShape.Create(self.manager, f"blendshape_{node.name}")
+            for channel in node.blendshapes:
+                fbx_channel = fbx.FbxBlendShapeChannel.Create(self.manager, channel.name)
+                for target_id, (target, full_weight) in enumerate(
+                    zip(channel.targets, channel.full_weights)
+                ):
+                    shape = fbx.FbxShape.Create(self.manager, f"{channel.name}_{target_id}")
+                    shape.InitControlPoints(len(target))
+                    for index, point in enumerate(target):
+                        shape.SetControlPointAt(fbx.FbxVector4(*point), index)
+                    fbx_channel.AddTargetShape(shape, full_weight)
+                primitives.set_or_create_properties(fbx_channel, channel.properties, self.scene)
+                blend_shape.AddBlendShapeChannel(fbx_channel)
+            fbx_node.GetNodeAttribute().AddDeformer(blend_shape)
+
+        # Fifth pass, vertex caches
+        for node, fbx_node in node_to_fbx_map.items():
+            if type(node) is not Mesh or node.vertex_cache is None:
+                continue
+
+            cache = fbx.FbxCache.Create(self.manager, f"cache_{node.name}")
+            cache.SetCacheFileFormat(fbx.FbxCache.EFileFormat.eMaxPointCacheV2)
+            cache_path = str(node.vertex_cache.resolve())
+            cache.SetCacheFileName(cache_path, cache_path)
+            deformer = fbx.FbxVertexCacheDeformer.Create(self.manager, f"vertexcache_{node.name}")
+            deformer.SetCache(cache)
+            deformer.Channel.Set(node.name)
+            deformer.Active.Set(True)
+            fbx_node.GetNodeAttribute().AddDeformer(deformer)
         return self.scene
 
 
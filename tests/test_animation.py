@@ -1,10 +1,11 @@
 from cmath import exp
+import time
 import pytest
 
-from pxr import Usd, Gf
+from pxr import Usd, Gf, Sdf, Tf
 import FbxCommon as fbx
 
-from helpers import validate_property_animation, validate_stage_time_metrics
+from helpers import validate_property_animation, validate_stage_time_metrics, create_FbxTime
 from data import scenebuilder, AnimationCurve, Property, TransformableNode
 
 
@@ -147,3 +148,269 @@ def test_user_property_animation(animated_user_property_fbx, root_prim_name):
     if start_end_flipped:
         expected_values = reversed(expected_values)
     validate_property_animation(stage, prop, expected_values)
+
+
+def build_takes_fbx(fbx_defaults, takes):
+    output_dir, manager, scene, fbx_file_format = fbx_defaults
+    times = [create_FbxTime(0), create_FbxTime(10)]
+    with scenebuilder.SceneBuilder(manager, scene, output_dir) as builder:
+        builder.settings.file_format = fbx_file_format
+        builder.settings.anim_layers = ("Base",)
+        builder.settings.anim_stacks = tuple(takes.keys())
+
+        curves = [
+            AnimationCurve(anim_layer="Base", anim_stack=take, times=times, values=values)
+            for take, values in takes.items()
+        ]
+        fbx_property = Property(
+            name="LclTranslation", animation_curves=curves, value=fbx.FbxDouble3(0.0, 0.0, 0.0)
+        )
+        builder.nodes.append(TransformableNode("null1", properties=[fbx_property]))
+    return (
+        str(builder.settings.file_path),
+        builder.nodes,
+        {take: Gf.Vec3d(*values[-1]) for take, values in takes.items()},
+    )
+
+
+@pytest.fixture(scope="session")
+def multiple_takes_fbx(fbx_defaults):
+    takes = {
+        "Walk": [(1.0, 2.0, 3.0), (10.0, 20.0, 30.0)],
+        "Run": [(-1.0, -2.0, -3.0), (-10.0, -20.0, -30.0)],
+    }
+    yield build_takes_fbx(fbx_defaults, takes)
+
+
+def test_take_selection(multiple_takes_fbx, root_prim_name):
+    file_path, nodes, expected_values = multiple_takes_fbx
+    prim_path = f"/{root_prim_name}/{nodes[0].name}"
+
+    # First take is used when none is given
+    stage = Usd.Stage.Open(file_path)
+    translate = stage.GetPrimAtPath(prim_path).GetAttribute("xformOp:translate")
+    assert translate.Get(10) == expected_values["Walk"]
+
+    layer = Sdf.Layer.FindOrOpen(file_path, args={"take": "Run"})
+    stage = Usd.Stage.Open(layer)
+    translate = stage.GetPrimAtPath(prim_path).GetAttribute("xformOp:translate")
+    assert translate.Get(10) == expected_values["Run"]
+
+    with pytest.raises(Tf.ErrorException):
+        _ = Sdf.Layer.FindOrOpen(file_path, args={"take": "Crawl"})
+
+
+def test_take_variants(multiple_takes_fbx, root_prim_name):
+    file_path, nodes, expected_values = multiple_takes_fbx
+    prim_path = f"/{root_prim_name}/{nodes[0].name}"
+
+    layer = Sdf.Layer.FindOrOpen(file_path, args={"takeVariants": "1"})
+    stage = Usd.Stage.Open(layer, load=Usd.Stage.LoadNone)
+    root = stage.GetPrimAtPath(f"/{root_prim_name}")
+    take_variants = root.GetVariantSets().GetVariantSet("take")
+    assert take_variants.GetVariantNames() == sorted(expected_values.keys())
+    assert take_variants.GetVariantSelection() == "Walk"
+
+    # Nothing is converted until the payload is loaded
+    assert root.HasAuthoredPayloads()
+    assert not stage.GetPrimAtPath(prim_path)
+
+    stage.Load()
+    translate = stage.GetPrimAtPath(prim_path).GetAttribute("xformOp:translate")
+    assert translate.Get(10) == expected_values["Walk"]
+
+    with Usd.EditContext(stage, stage.GetSessionLayer()):
+        take_variants.SetVariantSelection("Run")
+    translate = stage.GetPrimAtPath(prim_path).GetAttribute("xformOp:translate")
+    assert translate.Get(10) == expected_values["Run"]
+
+
+@pytest.fixture
+def unsafe_take_names_fbx(fbx_defaults):
+    takes = {
+        "Walk": [(1.0, 2.0, 3.0), (10.0, 20.0, 30.0)],
+        "Run&Jump": [(-1.0, -2.0, -3.0), (-10.0, -20.0, -30.0)],
+    }
+    yield build_takes_fbx(fbx_defaults, takes)
+
+
+def test_take_variants_unsafe_names(unsafe_take_names_fbx, root_prim_name, capfd):
+    file_path, nodes, expected_values = unsafe_take_names_fbx
+    prim_path = f"/{root_prim_name}/{nodes[0].name}"
+
+    # The take name cannot be passed on as a file format argument of the payload
+    layer = Sdf.Layer.FindOrOpen(file_path, args={"takeVariants": "1"})
+    _, err = capfd.readouterr()
+    assert 'Take "Run&Jump"' in err
+    stage = Usd.Stage.Open(layer)
+    take_variants = stage.GetPrimAtPath(f"/{root_prim_name}").GetVariantSets().GetVariantSet("take")
+    assert take_variants.GetVariantNames() == ["Walk"]
+    translate = stage.GetPrimAtPath(prim_path).GetAttribute("xformOp:translate")
+    assert translate.Get(10) == expected_values["Walk"]
+
+
+def test_frame_window(multiple_takes_fbx, root_prim_name):
+    file_path, nodes, _ = multiple_takes_fbx
+    prim_path = f"/{root_prim_name}/{nodes[0].name}"
+
+    reference = Usd.Stage.Open(file_path)
+    reference_translate = reference.GetPrimAtPath(prim_path).GetAttribute("xformOp:translate")
+
+    layer = Sdf.Layer.FindOrOpen(file_path, args={"startFrame": "2", "endFrame": "5"})
+    stage = Usd.Stage.Open(layer)
+    validate_stage_time_metrics(stage, (Usd.TimeCode(2), Usd.TimeCode(5)))
+
+    translate = stage.GetPrimAtPath(prim_path).GetAttribute("xformOp:translate")
+    assert translate.GetTimeSamples() == [2.0, 3.0, 4.0, 5.0]
+    for time in translate.GetTimeSamples():
+        assert Gf.IsClose(translate.Get(time), reference_translate.Get(time), 1e-6)
+
+
+def test_value_clips(multiple_takes_fbx, root_prim_name):
+    file_path, nodes, _ = multiple_takes_fbx
+    prim_path = f"/{root_prim_name}/{nodes[0].name}"
+
+    reference = Usd.Stage.Open(file_path)
+    reference_translate = reference.GetPrimAtPath(prim_path).GetAttribute("xformOp:translate")
+
+    layer = Sdf.Layer.FindOrOpen(file_path, args={"clipFrames": "4"})
+    # The main layer only carries topology, the samples come from the clips
+    assert not layer.ListTimeSamplesForPath(f"{prim_path}.xformOp:translate")
+
+    stage = Usd.Stage.Open(layer)
+    validate_stage_time_metrics(stage, (Usd.TimeCode(0), Usd.TimeCode(10)))
+    clips = Usd.ClipsAPI(stage.GetPrimAtPath(f"/{root_prim_name}"))
+    assert len(clips.GetClipAssetPaths()) == 3  # [0, 4], [4, 8], [8, 10]
+    assert clips.GetClipManifestAssetPath()
+
+    translate = stage.GetPrimAtPath(prim_path).GetAttribute("xformOp:translate")
+    for time in reference_translate.GetTimeSamples():
+        assert Gf.IsClose(translate.Get(time), reference_translate.Get(time), 1e-6)
+
+
+def test_value_clips_share_scene(multiple_takes_fbx, usdfbx_debug, root_prim_name, capfd):
+    file_path, nodes, _ = multiple_takes_fbx
+    prim_path = f"/{root_prim_name}/{nodes[0].name}"
+
+    layer = Sdf.Layer.FindOrOpen(file_path, args={"clipFrames": "5"})
+    stage = Usd.Stage.Open(layer)
+    translate = stage.GetPrimAtPath(prim_path).GetAttribute("xformOp:translate")
+    for time in range(11):
+        translate.Get(time)
+
+    # The clips and the manifest are converted from the scene the main layer imported
+    out, _ = capfd.readouterr()
+    reused = [l for l in out.splitlines() if l.startswith("UsdFbx - Reusing the scene imported from")]
+    clips = Usd.ClipsAPI(stage.GetPrimAtPath(f"/{root_prim_name}"))
+    assert len(reused) >= len(clips.GetClipAssetPaths())
+
+
+def test_unanimated_sampled_properties(multiple_takes_fbx, root_prim_name):
+    file_path, nodes, _ = multiple_takes_fbx
+    layer = Sdf.Layer.FindOrOpen(file_path)
+    prim_path = f"/{root_prim_name}/{nodes[0].name}"
+
+    # Only translation is animated, visibility is computed by a sampler that reads `Visibility`
+    assert len(layer.ListTimeSamplesForPath(f"{prim_path}.xformOp:translate")) == 11
+    assert not layer.ListTimeSamplesForPath(f"{prim_path}.visibility")
+
+
+@pytest.fixture(scope="session")
+def many_animated_nodes_fbx(fbx_defaults):
+    output_dir, manager, scene, fbx_file_format = fbx_defaults
+    num_nodes = 10000
+    times = [create_FbxTime(0), create_FbxTime(10)]
+    with scenebuilder.SceneBuilder(manager, scene, output_dir) as builder:
+        builder.settings.file_format = fbx_file_format
+        builder.settings.anim_layers = ("Base",)
+
+        for i in range(num_nodes):
+            curve = AnimationCurve(anim_layer="Base", times=times, values=[(0.0, 0.0, 0.0), (i, i, i)])
+            fbx_property = Property(
+                name="LclTranslation", animation_curves=[curve], value=fbx.FbxDouble3(0.0, 0.0, 0.0)
+            )
+            builder.nodes.append(TransformableNode(f"null{i}", properties=[fbx_property]))
+    yield str(builder.settings.file_path), builder.nodes
+
+
+def test_visibility_samples_on_animated_scene(many_animated_nodes_fbx, root_prim_name):
+    file_path, nodes = many_animated_nodes_fbx
+    layer = Sdf.Layer.FindOrOpen(file_path)
+
+    # Every node used to get a visibility sample per frame, only the animated translations are sampled now
+    num_translate_samples = 0
+    num_visibility_samples = 0
+    for node in nodes:
+        prim_path = f"/{root_prim_name}/{node.name}"
+        num_translate_samples += len(layer.ListTimeSamplesForPath(f"{prim_path}.xformOp:translate"))
+        num_visibility_samples += len(layer.ListTimeSamplesForPath(f"{prim_path}.visibility"))
+    assert num_translate_samples == len(nodes) * 11
+    assert num_visibility_samples == 0
+
+
+@pytest.fixture(scope="session")
+def layered_animation_fbx(fbx_defaults):
+    output_dir, manager, scene, fbx_file_format = fbx_defaults
+    times = [create_FbxTime(0), create_FbxTime(10)]
+    with scenebuilder.SceneBuilder(manager, scene, output_dir) as builder:
+        builder.settings.file_format = fbx_file_format
+        builder.settings.anim_layers = ("Base", "Additive")
+
+        curves = [
+            AnimationCurve(anim_layer="Base", times=times, values=[(1.0, 2.0, 3.0), (10.0, 20.0, 30.0)]),
+            AnimationCurve(anim_layer="Additive", times=times, values=[(0.0, 0.0, 0.0), (5.0, 5.0, 5.0)]),
+        ]
+        fbx_property = Property(
+            name="LclTranslation", animation_curves=curves, value=fbx.FbxDouble3(0.0, 0.0, 0.0)
+        )
+        builder.nodes.append(TransformableNode("null1", properties=[fbx_property]))
+    yield str(builder.settings.file_path), builder.nodes
+
+
+def test_layered_animation(layered_animation_fbx, root_prim_name):
+    file_path, nodes = layered_animation_fbx
+    stage = Usd.Stage.Open(file_path)
+    translate = stage.GetPrimAtPath(f"/{root_prim_name}/{nodes[0].name}").GetAttribute("xformOp:translate")
+
+    # Additive layers are blended on top of the base layer
+    assert Gf.IsClose(translate.Get(0), Gf.Vec3d(1.0, 2.0, 3.0), 1e-6)
+    assert Gf.IsClose(translate.Get(10), Gf.Vec3d(15.0, 25.0, 35.0), 1e-6)
+
+
+@pytest.fixture(scope="session")
+def large_single_layer_take_fbx(fbx_defaults):
+    output_dir, manager, scene, fbx_file_format = fbx_defaults
+    num_frames = 2000
+    times = [create_FbxTime(0), create_FbxTime(num_frames)]
+    with scenebuilder.SceneBuilder(manager, scene, output_dir) as builder:
+        builder.settings.file_format = fbx_file_format
+        builder.settings.anim_layers = ("Base",)
+
+        for i in range(100):
+            curve = AnimationCurve(anim_layer="Base", times=times, values=[(0.0, 0.0, 0.0), (i, i, i)])
+            fbx_property = Property(
+                name="LclTranslation", animation_curves=[curve], value=fbx.FbxDouble3(0.0, 0.0, 0.0)
+            )
+            builder.nodes.append(TransformableNode(f"null{i}", properties=[fbx_property]))
+    yield str(builder.settings.file_path), builder.nodes, num_frames
+
+
+@pytest.mark.benchmark
+def test_large_single_layer_take_benchmark(large_single_layer_take_fbx, root_prim_name):
+    file_path, nodes, num_frames = large_single_layer_take_fbx
+
+    start = time.perf_counter()
+    layer = Sdf.Layer.FindOrOpen(file_path)
+    elapsed = time.perf_counter() - start
+    print(f"Converted {len(nodes)} animated nodes over {num_frames + 1} frames in {elapsed:.3f}s")
+
+    stage = Usd.Stage.Open(layer)
+    translate = stage.GetPrimAtPath(f"/{root_prim_name}/{nodes[-1].name}").GetAttribute("xformOp:translate")
+    assert translate.GetNumTimeSamples() == num_frames + 1
+    assert Gf.IsClose(translate.Get(num_frames), Gf.Vec3d(len(nodes) - 1), 1e-6)
+
+    # Every node is sampled on every frame of the take, and nothing else is
+    num_samples = sum(
+        len(layer.ListTimeSamplesForPath(f"/{root_prim_name}/{node.name}.xformOp:translate")) for node in nodes
+    )
+    assert num_samples == len(nodes) * (num_frames + 1)
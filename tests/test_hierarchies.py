@@ -1,4 +1,7 @@
-from pxr import Usd
+import pytest
+from pxr import Usd, UsdGeom, UsdSkel, Sdf, Gf
+
+from data import scenebuilder, TransformableNode, Transform, Joint
 
 
 def test_simple_hierarchy(simple_hierarchy_fbx, root_prim_name):
@@ -8,3 +11,62 @@ def test_simple_hierarchy(simple_hierarchy_fbx, root_prim_name):
     child = nodes[1].name
     assert stage.GetPrimAtPath(f"/{root_prim_name}/{parent}")
     assert stage.GetPrimAtPath(f"/{root_prim_name}/{parent}/{child}")
+
+
+@pytest.fixture
+def wrapped_nulls_fbx(fbx_defaults):
+    output_dir, manager, scene, fbx_file_format = fbx_defaults
+    with scenebuilder.SceneBuilder(manager, scene, output_dir) as builder:
+        builder.settings.file_format = fbx_file_format
+        wrapper = TransformableNode("wrapper")
+        group = TransformableNode("group", parent=wrapper)
+        offset = TransformableNode("offset", parent=group, transform=Transform(t=(1.0, 2.0, 3.0)))
+        locator = TransformableNode("locator", parent=offset)
+        builder.nodes.extend([wrapper, group, offset, locator])
+
+    yield str(builder.settings.file_path), builder.nodes
+
+
+def test_flatten_nulls(wrapped_nulls_fbx, root_prim_name):
+    file_path, nodes = wrapped_nulls_fbx
+    layer = Sdf.Layer.FindOrOpen(file_path, args={"flattenNulls": "1"})
+    stage = Usd.Stage.Open(layer)
+
+    # Identity groups are gone, the nodes below them keep their names and transforms
+    assert not stage.GetPrimAtPath(f"/{root_prim_name}/wrapper")
+    offset = stage.GetPrimAtPath(f"/{root_prim_name}/offset")
+    assert offset
+    translation = UsdGeom.Xformable(offset).ComputeLocalToWorldTransform(0).ExtractTranslation()
+    assert Gf.IsClose(translation, Gf.Vec3d(1, 2, 3), 1e-6)
+
+    # Empty nulls are kept as locators
+    assert stage.GetPrimAtPath(f"/{root_prim_name}/offset/locator")
+
+    reference = Usd.Stage.Open(file_path)
+    assert reference.GetPrimAtPath(f"/{root_prim_name}/wrapper/group/offset/locator")
+
+
+@pytest.fixture
+def wrapped_skeleton_fbx(fbx_defaults):
+    output_dir, manager, scene, fbx_file_format = fbx_defaults
+    with scenebuilder.SceneBuilder(manager, scene, output_dir) as builder:
+        builder.settings.file_format = fbx_file_format
+        rig = TransformableNode("rig")
+        props = TransformableNode("props")
+        prop = TransformableNode("prop", parent=props, transform=Transform(t=(1.0, 0.0, 0.0)))
+        root = Joint(name="root", is_root=True, parent=rig)
+        child = Joint(name="child", parent=root, transform=Transform(t=(0.0, 1.0, 0.0)))
+        builder.nodes.extend([rig, props, prop, root, child])
+
+    yield str(builder.settings.file_path), builder.nodes
+
+
+def test_flatten_nulls_above_skeletons(wrapped_skeleton_fbx, root_prim_name):
+    file_path, nodes = wrapped_skeleton_fbx
+    layer = Sdf.Layer.FindOrOpen(file_path, args={"flattenNulls": "1"})
+    stage = Usd.Stage.Open(layer)
+
+    # Skeleton paths follow the node hierarchy, the null above the skeleton stays while the one next to it goes
+    assert UsdSkel.Skeleton.Get(stage, f"/{root_prim_name}/rig/root")
+    assert not stage.GetPrimAtPath(f"/{root_prim_name}/props")
+    assert stage.GetPrimAtPath(f"/{root_prim_name}/prop")
@@ -11,6 +11,7 @@ from data import (
     LambertMaterial,
     PhongMaterial,
     TextureChannel,
+    Transform,
 )
 
 
@@ -378,3 +379,53 @@ def test_unknown_uvs(
     material_names = [x.GetName() for x in mat_scope.GetChildren()]
     expected_material_names = [used_material.name, f"{used_material.name}__CLONE_1"]
     assert sorted(material_names) == sorted(expected_material_names)
+
+
+@pytest.fixture
+def static_planes_fbx(fbx_defaults):
+    output_dir, manager, scene, fbx_file_format = fbx_defaults
+    points = [(-1, 0, -1), (1, 0, -1), (1, 0, 1), (-1, 0, 1)]
+    with scenebuilder.SceneBuilder(manager, scene, output_dir) as builder:
+        builder.settings.file_format = fbx_file_format
+        for index in range(2):
+            builder.nodes.append(
+                Mesh(
+                    name=f"plane_{index}",
+                    transform=Transform(t=(index * 10.0, 0.0, 0.0)),
+                    points=points,
+                    polygons=[(0, 3, 2), (2, 1, 0)],
+                    materials=[
+                        (LambertMaterial(name="material_a", diffuse=(1, 0.5, 0)), [0]),
+                        (LambertMaterial(name="material_b", diffuse=(0, 0.5, 1)), [1]),
+                    ],
+                )
+            )
+        builder.nodes.append(
+            Mesh(name="unbound_plane", points=points, polygons=[(0, 3, 2), (2, 1, 0)])
+        )
+    yield str(builder.settings.file_path), builder.nodes
+
+
+def test_merge_static(static_planes_fbx, root_prim_name):
+    file_path, nodes = static_planes_fbx
+    layer = Sdf.Layer.FindOrOpen(file_path, args={"mergeStatic": "1"})
+    stage = Usd.Stage.Open(layer)
+
+    for node in nodes:
+        assert not stage.GetPrimAtPath(f"/{root_prim_name}/{node.name}")
+
+    # Meshes sharing their materials become one, in world space
+    merged = UsdGeom.Mesh.Get(stage, f"/{root_prim_name}/MERGED/material_a_material_b")
+    assert merged
+    points = merged.GetPointsAttr().Get()
+    assert len(points) == 8
+    for point, source in zip(points[4:], nodes[1].points):
+        assert Gf.IsClose(point, Gf.Vec3f(source) + Gf.Vec3f(10, 0, 0), 1e-5)
+    assert list(merged.GetFaceVertexIndicesAttr().Get()) == [0, 3, 2, 2, 1, 0, 4, 7, 6, 6, 5, 4]
+
+    subsets = UsdGeom.Subset.GetGeomSubsets(merged, UsdGeom.Tokens.face, "materialBind")
+    indices = {subset.GetPrim().GetName(): list(subset.GetIndicesAttr().Get()) for subset in subsets}
+    assert indices == {"SUBSET_material_a": [0, 2], "SUBSET_material_b": [1, 3]}
+
+    unbound = UsdGeom.Mesh.Get(stage, f"/{root_prim_name}/MERGED/unbound")
+    assert len(unbound.GetPointsAttr().Get()) == 4
@@ -75,8 +75,8 @@ def meters_per_unit_fbx(fbx_defaults, request):
         (expected_geo_value, 0, 0),
         (0, 0, expected_geo_value),
     ]
-    # This is the one that matters however, the fileformat plugin applies the cm->ConvertScene() call from the exported scene's
-    # SystemUnit, meaning that any SRT values are brought into the cm range
+    # This is the one that matters however, the fileformat plugin converts from the exported scene's SystemUnit to cm
+    # like FbxSystemUnit::ConvertScene() would, meaning that any SRT values are brought into the cm range
     yield str(
         builder.settings.file_path
     ), builder.nodes, value * factor, expected_points
@@ -109,7 +109,7 @@ def authored_vs_mixed_axis_fbx(fbx_defaults, request):
     output_dir, manager, scene, fbx_file_format = fbx_defaults
     in_points = [(-1, 0, -1), (1, 0, -1), (1, 0, 1), (-1, 0, 1)]
     in_normal = (0, 1, 0)
-    # Expected data for the MayaYUp authored will not change from the input when passed through FbxAxisSystem::DeepConvertScene
+    # Expected data for the MayaYUp authored will not change from the input when converted to Y-up
     expected_points = in_points
     expected_normal = in_normal
     if request.param[0] == fbx.FbxAxisSystem.Max:
@@ -145,7 +145,7 @@ def test_up_authored_vs_up_exported(authored_vs_mixed_axis_fbx, root_prim_name,
     """
     When exporting under a different up-axis than the authored one, some FBX exporters will apply offset rotations
     in the PreRotation attribute.
-    The plugin's transform reader however will use FbxAxisSystem::DeepConvertScene which will modify geometry and trs data accordingly (like flipping axis/negations)
+    The plugin's readers however convert geometry and trs data to Y-up like FbxAxisSystem::DeepConvertScene (like flipping axis/negations)
     This test looks for those geometry and transformation changes
     """
 
@@ -180,3 +180,61 @@ def test_up_authored_vs_up_exported(authored_vs_mixed_axis_fbx, root_prim_name,
     xform_api = UsdGeom.XformCommonAPI(target_prim)
     translation = xform_api.GetXformVectors(Usd.TimeCode.Default())[0]
     assert translation == expected_t
+
+
+@pytest.fixture(
+    params=[
+        (fbx.FbxAxisSystem.MayaYUp, fbx.FbxSystemUnit.cm),
+        (fbx.FbxAxisSystem.Max, fbx.FbxSystemUnit.cm),
+        (fbx.FbxAxisSystem.MayaYUp, fbx.FbxSystemUnit.m),
+        (fbx.FbxAxisSystem.Max, fbx.FbxSystemUnit.m),
+    ],
+    ids=["YUp cm", "ZUp cm", "YUp m", "ZUp m"],
+    scope="session",
+)
+def conversion_fbx(fbx_defaults, request):
+    output_dir, manager, scene, fbx_file_format = fbx_defaults
+    axis, units = request.param
+    is_z_up = axis == fbx.FbxAxisSystem.Max
+    expected_points = [(-1, 0, -1), (1, 0, -1), (1, 0, 1), (-1, 0, 1)]
+    in_points = [(-1, -1, 0), (1, -1, 0), (1, 1, 0), (-1, 1, 0)] if is_z_up else expected_points
+    with scenebuilder.SceneBuilder(manager, scene, output_dir) as builder:
+        builder.settings.file_format = fbx_file_format
+        builder.settings.axis = axis
+        builder.settings.units = units
+        builder.nodes.append(
+            Mesh(
+                name="basic_plane",
+                points=in_points,
+                polygons=[(0, 3, 2), (2, 1, 0)],
+                transform=Transform((10, 20, 30)),
+            )
+        )
+
+    factor = fbx.FbxSystemUnit.cm.GetConversionFactorFrom(units)
+    expected_t = (10 * factor, 30 * factor, -20 * factor) if is_z_up else (10 * factor, 20 * factor, 30 * factor)
+    converts_units = units != fbx.FbxSystemUnit.cm
+    yield str(builder.settings.file_path), builder.nodes, is_z_up, converts_units, expected_t, expected_points
+
+
+def test_skipped_conversion(conversion_fbx, usdfbx_debug, root_prim_name, capfd):
+    """
+    Y-up centimeter scenes are left untouched, any other scene is converted by the readers and ends up with the
+    same data the FBX SDK conversions gave it
+    """
+    file_path, nodes, converts_axis, converts_units, expected_t, expected_points = conversion_fbx
+    stage = Usd.Stage.Open(file_path)
+
+    out, _ = capfd.readouterr()
+    conversions = [l for l in out.splitlines() if l.startswith("UsdFbx - Converting from")]
+    assert any(l.endswith("Coordinate system") for l in conversions) == converts_axis
+    assert any(l.endswith("metersPerUnit") for l in conversions) == converts_units
+
+    assert UsdGeom.GetStageUpAxis(stage) == UsdGeom.Tokens.y
+    assert UsdGeom.GetStageMetersPerUnit(stage) == 0.01
+
+    target_prim = stage.GetPrimAtPath(f"/{root_prim_name}/{nodes[0].name}")
+    for coord in UsdGeom.Mesh(target_prim).GetPointsAttr().Get():
+        assert coord in expected_points
+    translation = UsdGeom.XformCommonAPI(target_prim).GetXformVectors(Usd.TimeCode.Default())[0]
+    assert translation == expected_t
@@ -1,11 +1,14 @@
 import pytest
-from pxr import Usd, UsdGeom, Vt
+import struct
+from pxr import Usd, UsdGeom, Vt, Gf, Sdf
 
 from dataclasses import dataclass
 from typing import Tuple
 import string
 
-from data import scenebuilder, MappedCoordinates, Mesh
+from data import scenebuilder, MappedCoordinates, Mesh, Property, AnimationCurve, Transform, TransformableNode
+from helpers import create_FbxTime
+import FbxCommon as fbx
 
 
 def basic_plane_helper(basic_plane_fbx, root_prim_name):
@@ -165,3 +168,266 @@ def test_vertex_colors(vertex_colors_plane_fbx, root_prim_name):
         print(mesh.vertex_colors[layer_index], layer_index)
         color_set = mesh.vertex_colors[layer_index]
         # assert colors == [color_set.coordinates for i in color_set.point_mapping]
+
+
+def cached_point(sample, point):
+    return (float(point), 0.1 * sample * (point + 1), 0.0)
+
+
+@pytest.fixture
+def vertex_cache_plane_fbx(fbx_defaults):
+    output_dir, manager, scene, fbx_file_format = fbx_defaults
+    points = [(-1, 0, -1), (1, 0, -1), (1, 0, 1), (-1, 0, 1)]
+
+    # One sample every other frame, from frame 0 to 24
+    cache_path = output_dir / "basic_plane.pc2"
+    num_samples = 13
+    with open(cache_path, "wb") as cache_file:
+        cache_file.write(struct.pack("<12siiffi", b"POINTCACHE2", 1, len(points), 0.0, 2.0, num_samples))
+        for sample in range(num_samples):
+            for point in range(len(points)):
+                cache_file.write(struct.pack("<3f", *cached_point(sample, point)))
+
+    with scenebuilder.SceneBuilder(manager, scene, output_dir) as builder:
+        builder.settings.file_format = fbx_file_format
+        builder.settings.anim_layers = ("Base",)
+        # The take only spans the frames its curves are keyed at
+        translation = Property(
+            name="LclTranslation",
+            value=fbx.FbxDouble3(0.0, 0.0, 0.0),
+            animation_curves=[
+                AnimationCurve(
+                    anim_layer="Base",
+                    times=[create_FbxTime(0), create_FbxTime(24)],
+                    values=[(0.0, 0.0, 0.0), (0.0, 0.0, 0.0)],
+                )
+            ],
+        )
+        mesh = Mesh(
+            name="basic_plane",
+            points=points,
+            polygons=[(0, 3, 2), (2, 1, 0)],
+            properties=[translation],
+            vertex_cache=cache_path,
+        )
+        builder.nodes.append(mesh)
+
+    yield str(builder.settings.file_path), builder.nodes
+
+
+def test_vertex_cache(vertex_cache_plane_fbx, root_prim_name):
+    file_path, nodes = vertex_cache_plane_fbx
+    stage = Usd.Stage.Open(file_path)
+    mesh = UsdGeom.Mesh.Get(stage, f"/{root_prim_name}/{nodes[0].name}")
+    points = mesh.GetPointsAttr()
+    assert points.GetNumTimeSamples() == 25
+
+    # Frames with a cache sample read it as is, the ones in between blend the two around them
+    for frame in (0, 4, 5, 24):
+        sample = frame / 2.0
+        expected = [
+            Gf.Vec3f(*cached_point(sample, point)) for point in range(len(nodes[0].points))
+        ]
+        for point, expected_point in zip(points.Get(frame), expected):
+            assert Gf.IsClose(point, expected_point, 1e-5)
+
+
+def sequence_point(frame, point):
+    return (float(point), float(frame), 0.0)
+
+
+@pytest.fixture
+def plane_sequence_fbx(fbx_defaults, request):
+    axis = getattr(request, "param", fbx.FbxAxisSystem.MayaYUp)
+    output_dir, manager, scene, fbx_file_format = fbx_defaults
+    sequence_dir = output_dir / ("plane_sequence" if axis == fbx.FbxAxisSystem.MayaYUp else "plane_sequence_z_up")
+    sequence_dir.mkdir(exist_ok=True)
+
+    # Every file holds the same plane with its points moved to the frame number
+    file_paths = []
+    for frame in (1, 2, 3):
+        with scenebuilder.SceneBuilder(manager, scene, output_dir) as builder:
+            builder.settings.file_format = fbx_file_format
+            builder.settings.axis = axis
+            builder.settings.file_path = sequence_dir / f"plane_{frame:04d}.fbx"
+            mesh = Mesh(
+                name="basic_plane",
+                points=[sequence_point(frame, point) for point in range(4)],
+                polygons=[(0, 3, 2), (2, 1, 0)],
+            )
+            builder.nodes.append(mesh)
+        file_paths.append(str(builder.settings.file_path))
+
+    yield file_paths, builder.nodes
+
+
+def test_file_sequence(plane_sequence_fbx, root_prim_name):
+    file_paths, nodes = plane_sequence_fbx
+    layer = Sdf.Layer.FindOrOpen(file_paths[0], args={"sequence": "1"})
+    stage = Usd.Stage.Open(layer)
+    assert stage.GetStartTimeCode() == 1
+    assert stage.GetEndTimeCode() == 3
+
+    points = UsdGeom.Mesh.Get(stage, f"/{root_prim_name}/{nodes[0].name}").GetPointsAttr()
+    assert points.GetTimeSamples() == [1.0, 2.0, 3.0]
+    # Read out of order, frames come from the cache or their file either way
+    for frame in (3, 1, 2, 3):
+        expected = [Gf.Vec3f(*sequence_point(frame, point)) for point in range(4)]
+        for point, expected_point in zip(points.Get(frame), expected):
+            assert Gf.IsClose(point, expected_point, 1e-5)
+
+
+@pytest.mark.parametrize("plane_sequence_fbx", [fbx.FbxAxisSystem.Max], ids=["Z-up"], indirect=True)
+def test_file_sequence_conversion(plane_sequence_fbx, root_prim_name):
+    file_paths, nodes = plane_sequence_fbx
+    layer = Sdf.Layer.FindOrOpen(file_paths[0], args={"sequence": "1"})
+    points = UsdGeom.Mesh.Get(Usd.Stage.Open(layer), f"/{root_prim_name}/{nodes[0].name}").GetPointsAttr()
+
+    # Every file is converted to Y-up like the first one, Z-up (x, y, z) ends up at (x, z, -y)
+    for frame in (1, 2, 3):
+        expected = [Gf.Vec3f(x, z, -y) for x, y, z in (sequence_point(frame, point) for point in range(4))]
+        frame_points = points.Get(frame)
+        assert len(frame_points) == len(expected)
+        for point in frame_points:
+            assert any(Gf.IsClose(point, expected_point, 1e-5) for expected_point in expected)
+
+
+@pytest.fixture
+def same_named_sequence_fbx(fbx_defaults):
+    output_dir, manager, scene, fbx_file_format = fbx_defaults
+    sequence_dir = output_dir / "same_named_sequence"
+    sequence_dir.mkdir(exist_ok=True)
+
+    file_paths = []
+    for frame in (1, 2):
+        with scenebuilder.SceneBuilder(manager, scene, output_dir) as builder:
+            builder.settings.file_format = fbx_file_format
+            builder.settings.file_path = sequence_dir / f"planes_{frame:04d}.fbx"
+            for offset in (0.0, 5.0):
+                builder.nodes.append(
+                    Mesh(
+                        name="plane",
+                        points=[sequence_point(frame, point) for point in range(4)],
+                        polygons=[(0, 3, 2), (2, 1, 0)],
+                        transform=Transform(t=(offset, 0.0, 0.0)),
+                    )
+                )
+        file_paths.append(str(builder.settings.file_path))
+
+    yield file_paths, builder.nodes
+
+
+def test_file_sequence_same_names(same_named_sequence_fbx, capfd):
+    file_paths, _ = same_named_sequence_fbx
+    layer = Sdf.Layer.FindOrOpen(file_paths[0], args={"sequence": "1"})
+    stage = Usd.Stage.Open(layer)
+
+    # Meshes that cannot be told apart in the other files keep the points of the first file
+    _, err = capfd.readouterr()
+    assert 'Several meshes are named "plane"' in err
+    meshes = [UsdGeom.Mesh(prim) for prim in stage.Traverse() if prim.IsA(UsdGeom.Mesh)]
+    assert len(meshes) == 2
+    for mesh in meshes:
+        assert mesh.GetPointsAttr().GetNumTimeSamples() == 0
+        expected = [Gf.Vec3f(*sequence_point(1, point)) for point in range(4)]
+        for point, expected_point in zip(mesh.GetPointsAttr().Get(), expected):
+            assert Gf.IsClose(point, expected_point, 1e-5)
+
+
+@pytest.fixture
+def instanced_plane_fbx(fbx_defaults):
+    output_dir, manager, scene, fbx_file_format = fbx_defaults
+    with scenebuilder.SceneBuilder(manager, scene, output_dir) as builder:
+        builder.settings.file_format = fbx_file_format
+        plane = Mesh(
+            name="plane",
+            points=[(-1, 0, -1), (1, 0, -1), (1, 0, 1), (-1, 0, 1)],
+            polygons=[(0, 3, 2), (2, 1, 0)],
+        )
+        builder.nodes.append(plane)
+        for index in range(1, 4):
+            builder.nodes.append(
+                Mesh(
+                    name=f"plane_copy_{index}",
+                    transform=Transform(t=(index * 3.0, 0.0, 0.0)),
+                    instance_of=plane,
+                )
+            )
+
+    yield str(builder.settings.file_path), builder.nodes
+
+
+def test_mesh_instancing(instanced_plane_fbx, root_prim_name):
+    file_path, nodes = instanced_plane_fbx
+    stage = Usd.Stage.Open(file_path)
+
+    # The shared mesh is converted once, every node is an instance of it
+    prototypes = stage.GetPrimAtPath(f"/{root_prim_name}/MESHES")
+    assert prototypes.IsAbstract()
+    assert len(prototypes.GetChildren()) == 1
+
+    for node in nodes:
+        prim = stage.GetPrimAtPath(f"/{root_prim_name}/{node.name}")
+        assert prim.IsInstance()
+        mesh = UsdGeom.Mesh(prim)
+        assert mesh.GetPointsAttr().Get() == nodes[0].points
+        assert mesh.GetFaceVertexCountsAttr().Get() == [3, 3]
+
+    copy = UsdGeom.Xformable(stage.GetPrimAtPath(f"/{root_prim_name}/{nodes[3].name}"))
+    assert Gf.IsClose(copy.ComputeLocalToWorldTransform(0).ExtractTranslation(), Gf.Vec3d(9, 0, 0), 1e-6)
+
+
+
+@pytest.fixture
+def colliding_prototype_names_fbx(fbx_defaults):
+    output_dir, manager, scene, fbx_file_format = fbx_defaults
+    with scenebuilder.SceneBuilder(manager, scene, output_dir) as builder:
+        builder.settings.file_format = fbx_file_format
+        # /ROOT/a_b/c and /ROOT/a/b_c flatten to the same prototype name
+        for parent_name, name, height in (("a_b", "c", 0.0), ("a", "b_c", 1.0)):
+            parent = TransformableNode(parent_name)
+            mesh = Mesh(
+                name=name,
+                points=[(-1, height, -1), (1, height, -1), (1, height, 1), (-1, height, 1)],
+                polygons=[(0, 3, 2), (2, 1, 0)],
+                parent=parent,
+            )
+            copy = Mesh(name=f"{name}_copy", transform=Transform(t=(3.0, 0.0, 0.0)), instance_of=mesh)
+            builder.nodes.extend([parent, mesh, copy])
+
+    yield str(builder.settings.file_path), builder.nodes
+
+
+def test_mesh_instancing_colliding_names(colliding_prototype_names_fbx, root_prim_name):
+    file_path, nodes = colliding_prototype_names_fbx
+    stage = Usd.Stage.Open(file_path)
+
+    prototypes = stage.GetPrimAtPath(f"/{root_prim_name}/MESHES")
+    assert sorted(child.GetName() for child in prototypes.GetChildren()) == ["a_b_c", "a_b_c_1"]
+
+    for parent, mesh, copy in (nodes[0:3], nodes[3:6]):
+        for path in (f"/{root_prim_name}/{parent.name}/{mesh.name}", f"/{root_prim_name}/{copy.name}"):
+            assert UsdGeom.Mesh.Get(stage, path).GetPointsAttr().Get() == mesh.points
+
+
+def test_point_instancer(instanced_plane_fbx, root_prim_name):
+    file_path, nodes = instanced_plane_fbx
+    layer = Sdf.Layer.FindOrOpen(file_path, args={"pointInstancer": "1"})
+    stage = Usd.Stage.Open(layer)
+
+    # The planes are drawn by a single instancer instead of a prim each
+    for node in nodes:
+        assert not stage.GetPrimAtPath(f"/{root_prim_name}/{node.name}")
+    instancer = UsdGeom.PointInstancer.Get(stage, f"/{root_prim_name}/INSTANCES")
+    assert instancer
+
+    prototypes = instancer.GetPrototypesRel().GetTargets()
+    assert len(prototypes) == 1
+    prototype = UsdGeom.Mesh(stage.GetPrimAtPath(prototypes[0]))
+    assert prototype.GetPointsAttr().Get() == nodes[0].points
+
+    assert list(instancer.GetProtoIndicesAttr().Get()) == [0, 0, 0, 0]
+    for index, position in enumerate(instancer.GetPositionsAttr().Get()):
+        assert Gf.IsClose(position, Gf.Vec3f(index * 3.0, 0, 0), 1e-6)
+    assert instancer.GetOrientationsAttr().Get()[0] == Gf.Quath(1)
+    assert instancer.GetScalesAttr().Get()[0] == Gf.Vec3f(1)
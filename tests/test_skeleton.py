@@ -1,13 +1,18 @@
+import re
 import string
+import time
 from typing import List
 
 import pytest
 
 import FbxCommon as fbx
 
-from pxr import Usd, UsdGeom, UsdSkel, Sdf, Gf
+from pxr import Usd, UsdGeom, UsdSkel, Sdf, Gf, Tf
+from helpers import create_FbxTime
 from data import (
+    BlendShapeChannel,
     Joint,
+    MappedCoordinates,
     Mesh,
     SkinBinding,
     TransformableNode,
@@ -157,6 +162,88 @@ def test_nested_skeleton(nested_skeletons_fbx, root_prim_name):
     assert parent and not parent.IsA(UsdSkel.Skeleton)
 
 
+@pytest.fixture
+def nested_skeleton_binding_fbx(fbx_defaults):
+    output_dir, manager, scene, fbx_file_format = fbx_defaults
+    with scenebuilder.SceneBuilder(manager, scene, output_dir) as builder:
+        builder.settings.file_format = fbx_file_format
+        null = TransformableNode(name="null")
+        root = Joint(name="root", parent=null, is_root=True)
+        child = Joint(name="child", parent=root, transform=Transform(t=(10.0, 0.0, 0.0)))
+        geo = Mesh(
+            name="bound_skin",
+            points=[(0, 0, -1), (0, 0, 1), (10, 0, -1), (10, 0, 1)],
+            skinbinding=(
+                SkinBinding(target_joint=root, vertex_weights=((0, 1.0), (1, 1.0))),
+                SkinBinding(target_joint=child, vertex_weights=((2, 1.0), (3, 1.0))),
+            ),
+            polygons=[(0, 1, 3), (3, 2, 0)],
+        )
+        builder.nodes.extend([null, root, child, geo])
+    yield str(builder.settings.file_path), builder.nodes
+
+
+def test_nested_skeleton_binding(nested_skeleton_binding_fbx, root_prim_name):
+    """
+    Skinned meshes bind to the Skeleton prim wherever it sits in the hierarchy,
+    with the same joint paths the Skeleton itself uses.
+    """
+    file_path, nodes = nested_skeleton_binding_fbx
+    stage = Usd.Stage.Open(file_path)
+
+    skeleton = UsdSkel.Skeleton.Get(stage, f"/{root_prim_name}/null/root")
+    assert skeleton
+
+    binding_api = UsdSkel.BindingAPI(stage.GetPrimAtPath(f"/{root_prim_name}/bound_skin"))
+    assert binding_api.GetSkeletonRel().GetTargets() == [skeleton.GetPath()]
+
+    skeleton_joints = list(skeleton.GetJointsAttr().Get())
+    assert skeleton_joints == ["root", "root/child"]
+    assert set(binding_api.GetJointsAttr().Get()) <= set(skeleton_joints)
+
+
+@pytest.fixture
+def identical_rigs_fbx(fbx_defaults):
+    output_dir, manager, scene, fbx_file_format = fbx_defaults
+    with scenebuilder.SceneBuilder(manager, scene, output_dir) as builder:
+        builder.settings.file_format = fbx_file_format
+        for index in range(3):
+            null = TransformableNode(name=f"character{index}", transform=Transform(t=(100.0 * index, 0.0, 0.0)))
+            root = Joint(name="root", parent=null, is_root=True)
+            spine = Joint(name="spine", parent=root, transform=Transform(t=(0.0, 10.0, 0.0)))
+            head = Joint(name="head", parent=spine, transform=Transform(t=(0.0, 10.0, 0.0)))
+            builder.nodes.extend([null, root, spine, head])
+    yield str(builder.settings.file_path), builder.nodes
+
+
+def test_identical_rigs_share_a_skeleton(identical_rigs_fbx, root_prim_name):
+    file_path, nodes = identical_rigs_fbx
+    layer = Sdf.Layer.FindOrOpen(file_path)
+    stage = Usd.Stage.Open(layer)
+
+    skeleton_paths = [Sdf.Path(f"/{root_prim_name}/character{index}/root") for index in range(3)]
+    prototype_paths = set()
+    for index, path in enumerate(skeleton_paths):
+        # Joints and rest pose are only authored once, every copy references them
+        assert not layer.GetAttributeAtPath(path.AppendProperty("joints"))
+        assert not layer.GetAttributeAtPath(path.AppendProperty("restTransforms"))
+        references = layer.GetPrimAtPath(path).referenceList.explicitItems
+        assert len(references) == 1
+        prototype_paths.add(references[0].primPath)
+
+        skeleton = UsdSkel.Skeleton.Get(stage, path)
+        assert list(skeleton.GetJointsAttr().Get()) == ["root", "root/spine", "root/spine/head"]
+        assert len(skeleton.GetRestTransformsAttr().Get()) == 3
+        # Bind transforms stay specific to where each copy was bound
+        bind_transforms = skeleton.GetBindTransformsAttr().Get()
+        assert Gf.IsClose(bind_transforms[0].ExtractTranslation(), Gf.Vec3d(100.0 * index, 0.0, 0.0), 1e-5)
+
+    assert len(prototype_paths) == 1
+    prototype = stage.GetPrimAtPath(prototype_paths.pop())
+    assert prototype and prototype.IsAbstract()
+    assert [prim.GetPath() for prim in stage.Traverse() if prim.IsA(UsdSkel.Skeleton)] == skeleton_paths
+
+
 @pytest.fixture
 def mixed_type_hierarchy_fbx(fbx_defaults):
     output_dir, manager, scene, fbx_file_format = fbx_defaults
@@ -286,6 +373,56 @@ def test_simple_binding(skeleton_binding_fbx, root_prim_name):
                 ), "Weights and indices must match in elementSize!"
 
 
+def test_binding_weights_are_normalized_and_sorted(skeleton_binding_fbx, root_prim_name):
+    file_path, nodes = skeleton_binding_fbx
+    stage = Usd.Stage.Open(file_path)
+    binding_api = UsdSkel.BindingAPI(stage.GetPrimAtPath(f"/{root_prim_name}/{nodes[-1].name}"))
+
+    indices_primvar = UsdGeom.Primvar(binding_api.GetJointIndicesAttr())
+    weights_primvar = UsdGeom.Primvar(binding_api.GetJointWeightsAttr())
+    element_size = weights_primvar.GetElementSize()
+    # The middle control points are influenced by all three joints
+    assert element_size == 3
+
+    indices = indices_primvar.Get()
+    weights = weights_primvar.Get()
+    assert len(indices) == len(weights) == len(nodes[-1].points) * element_size
+    for point in range(len(nodes[-1].points)):
+        point_weights = list(weights[point * element_size : (point + 1) * element_size])
+        assert sum(point_weights) == pytest.approx(1.0)
+        assert point_weights == sorted(point_weights, reverse=True)
+
+    # Control point 2 gets half of its weight from B, the second joint of the binding
+    assert indices[2 * element_size] == 1
+    assert weights[2 * element_size] == pytest.approx(0.5)
+
+
+@pytest.mark.parametrize(
+    "args,expected_element_size,expected_weights",
+    [
+        ({"maxInfluences": "2"}, 2, [2.0 / 3.0, 1.0 / 3.0]),
+        ({"minWeight": "0.3"}, 1, [1.0]),
+    ],
+)
+def test_binding_influences_are_pruned(
+    skeleton_binding_fbx, root_prim_name, args, expected_element_size, expected_weights
+):
+    file_path, nodes = skeleton_binding_fbx
+    stage = Usd.Stage.Open(Sdf.Layer.FindOrOpen(file_path, args=args))
+    binding_api = UsdSkel.BindingAPI(stage.GetPrimAtPath(f"/{root_prim_name}/{nodes[-1].name}"))
+
+    indices_primvar = UsdGeom.Primvar(binding_api.GetJointIndicesAttr())
+    weights_primvar = UsdGeom.Primvar(binding_api.GetJointWeightsAttr())
+    assert indices_primvar.GetElementSize() == expected_element_size
+    assert weights_primvar.GetElementSize() == expected_element_size
+
+    # Control point 2 is influenced by all three joints, B the most
+    weights = weights_primvar.Get()
+    point_weights = weights[2 * expected_element_size : 3 * expected_element_size]
+    assert list(point_weights) == pytest.approx(expected_weights)
+    assert indices_primvar.Get()[2 * expected_element_size] == 1
+
+
 @pytest.fixture(
     params=[
         (
@@ -397,3 +534,428 @@ def test_skeletonCleanedNames(simple_skeleton_dirty_names_fbx, root_prim_name):
 
     joint_order = query.GetJointOrder()
     assert joint_order == expected_topology
+
+
+@pytest.fixture
+def animated_skeleton_fbx(fbx_defaults, request):
+    units = getattr(request, "param", fbx.FbxSystemUnit.cm)
+    output_dir, manager, scene, fbx_file_format = fbx_defaults
+    times = [create_FbxTime(0), create_FbxTime(24)]
+    with scenebuilder.SceneBuilder(manager, scene, output_dir) as builder:
+        builder.settings.file_format = fbx_file_format
+        builder.settings.anim_layers = ("Base",)
+        builder.settings.units = units
+        builder.settings.original_units = units
+
+        translation = Property(
+            name="LclTranslation",
+            value=fbx.FbxDouble3(0.0, 40.0, 0.0),
+            animation_curves=[
+                AnimationCurve(
+                    anim_layer="Base",
+                    times=times,
+                    values=[(0.0, 40.0, 0.0), (-15.0, 55.0, 30.0)],
+                )
+            ],
+        )
+        rotation = Property(
+            name="LclRotation",
+            value=fbx.FbxDouble3(0.0, 0.0, 0.0),
+            animation_curves=[
+                AnimationCurve(
+                    anim_layer="Base",
+                    times=times,
+                    values=[(0.0, 0.0, 0.0), (90.0, 45.0, -120.0)],
+                )
+            ],
+        )
+        root_node = Joint(name="root", is_root=True)
+        child_1 = Joint(
+            name="child_1", parent=root_node, properties=[translation, rotation]
+        )
+        child_2 = Joint(name="child_2", parent=child_1, properties=[rotation])
+        builder.nodes.extend([root_node, child_1, child_2])
+    yield str(builder.settings.file_path), builder.nodes
+
+
+def test_quantized_skeleton_animation(animated_skeleton_fbx, root_prim_name):
+    file_path, nodes = animated_skeleton_fbx
+    anim_path = f"/{root_prim_name}/Animation{nodes[0].name}"
+
+    reference = Usd.Stage.Open(file_path).GetPrimAtPath(anim_path)
+    layer = Sdf.Layer.FindOrOpen(file_path, args={"quantizeSkelAnimation": "1"})
+    quantized = Usd.Stage.Open(layer).GetPrimAtPath(anim_path)
+    assert reference and quantized
+
+    for attr_name in ("translations", "rotations"):
+        reference_attr = reference.GetAttribute(attr_name)
+        quantized_attr = quantized.GetAttribute(attr_name)
+        assert quantized_attr.GetTimeSamples() == reference_attr.GetTimeSamples()
+        assert len(quantized_attr.GetTimeSamples()) == 25
+
+        for time in reference_attr.GetTimeSamples():
+            expected_values = reference_attr.Get(time)
+            values = quantized_attr.Get(time)
+            # The root joint never moves and is left to the rest transforms
+            assert len(values) == len(expected_values) == len(nodes) - 1
+            for expected, value in zip(expected_values, values):
+                if attr_name == "rotations":
+                    # q and -q describe the same rotation
+                    dot = expected.GetReal() * value.GetReal() + Gf.Dot(
+                        expected.GetImaginary(), value.GetImaginary()
+                    )
+                    assert abs(dot) == pytest.approx(1.0, abs=1e-5)
+                else:
+                    assert Gf.IsClose(expected, value, 1e-2)
+
+
+@pytest.fixture
+def large_animated_skeleton_fbx(fbx_defaults):
+    output_dir, manager, scene, fbx_file_format = fbx_defaults
+    num_joints = 200
+    num_frames = 240
+    times = [create_FbxTime(0), create_FbxTime(num_frames)]
+    with scenebuilder.SceneBuilder(manager, scene, output_dir) as builder:
+        builder.settings.file_format = fbx_file_format
+        builder.settings.anim_layers = ("Base",)
+
+        parent = Joint(name="root", is_root=True)
+        builder.nodes.append(parent)
+        for index in range(1, num_joints):
+            translation = Property(
+                name="LclTranslation",
+                value=fbx.FbxDouble3(0.0, 10.0, 0.0),
+                animation_curves=[
+                    AnimationCurve(anim_layer="Base", times=times, values=[(0.0, 10.0, 0.0), (index * 0.1, 10.0, 1.0)])
+                ],
+            )
+            rotation = Property(
+                name="LclRotation",
+                value=fbx.FbxDouble3(0.0, 0.0, 0.0),
+                animation_curves=[
+                    AnimationCurve(anim_layer="Base", times=times, values=[(0.0, 0.0, 0.0), (index % 90, 45.0, -30.0)])
+                ],
+            )
+            parent = Joint(name=f"joint_{index}", parent=parent, properties=[translation, rotation])
+            builder.nodes.append(parent)
+    yield str(builder.settings.file_path), builder.nodes, num_frames
+
+
+@pytest.fixture
+def usdfbx_perf_debug(registry):
+    plugin = registry.GetPluginWithName("usdFbx")
+    if not plugin.isLoaded:
+        plugin.Load()
+    Tf.Debug.SetDebugSymbolsByName("USDFBX_PERF", 1)
+    yield
+    Tf.Debug.SetDebugSymbolsByName("USDFBX_PERF", 0)
+
+
+@pytest.mark.benchmark
+def test_quantized_skeleton_animation_benchmark(
+    large_animated_skeleton_fbx, usdfbx_perf_debug, root_prim_name, capfd
+):
+    file_path, nodes, num_frames = large_animated_skeleton_fbx
+    anim_path = f"/{root_prim_name}/Animation{nodes[0].name}"
+    frames = range(num_frames + 1)
+
+    capfd.readouterr()
+    layer = Sdf.Layer.FindOrOpen(file_path, args={"quantizeSkelAnimation": "1"})
+    out, _ = capfd.readouterr()
+    match = re.search(r"Quantized SkelAnimation with \d+ joints over \d+ frames: (\d+) bytes -> (\d+) bytes", out)
+    assert match
+    raw_size, quantized_size = int(match.group(1)), int(match.group(2))
+    quantized = Usd.Stage.Open(layer).GetPrimAtPath(anim_path)
+    reference = Usd.Stage.Open(file_path).GetPrimAtPath(anim_path)
+
+    def read_frames(prim):
+        start = time.perf_counter()
+        values = [(prim.GetAttribute("translations").Get(f), prim.GetAttribute("rotations").Get(f)) for f in frames]
+        return values, (time.perf_counter() - start) / len(frames)
+
+    reference_values, reference_latency = read_frames(reference)
+    quantized_values, quantized_latency = read_frames(quantized)
+    ratio = raw_size / quantized_size
+    print(
+        f"{len(nodes) - 1} joints over {len(frames)} frames: {raw_size} bytes raw, {quantized_size} bytes quantized "
+        f"({ratio:.2f}:1), {reference_latency * 1e6:.1f}us per raw frame, {quantized_latency * 1e6:.1f}us per decoded frame"
+    )
+
+    for (expected_translations, _), (translations, _) in zip(reference_values, quantized_values):
+        assert len(translations) == len(expected_translations) == len(nodes) - 1
+        for expected, value in zip(expected_translations, translations):
+            assert Gf.IsClose(expected, value, 1e-2)
+    assert ratio > 2.0
+
+
+def test_static_joints_are_left_to_rest_transforms(animated_skeleton_fbx, root_prim_name):
+    file_path, nodes = animated_skeleton_fbx
+    stage = Usd.Stage.Open(file_path)
+    skeleton = UsdSkel.Skeleton.Get(stage, f"/{root_prim_name}/{nodes[0].name}")
+    animation = UsdSkel.Animation.Get(stage, f"/{root_prim_name}/Animation{nodes[0].name}")
+    assert skeleton and animation
+
+    # Only the joints that move are part of the animation
+    assert list(animation.GetJointsAttr().Get()) == ["root/child_1", "root/child_1/child_2"]
+    assert len(animation.GetTranslationsAttr().Get(Usd.TimeCode(24))) == 2
+
+    cache = UsdSkel.Cache()
+    query = cache.GetSkelQuery(skeleton)
+    assert query.GetAnimQuery()
+    rest_transforms = skeleton.GetRestTransformsAttr().Get()
+    for time in (0, 12, 24):
+        local_transforms = query.ComputeJointLocalTransforms(Usd.TimeCode(time))
+        assert Gf.IsClose(local_transforms[0], rest_transforms[0], 1e-5)
+
+
+@pytest.mark.parametrize(
+    "animated_skeleton_fbx", [fbx.FbxSystemUnit.m, fbx.FbxSystemUnit.Inch], ids=["m", "inch"], indirect=True
+)
+def test_animated_joints_match_rest_transform_units(animated_skeleton_fbx, root_prim_name):
+    file_path, nodes = animated_skeleton_fbx
+    stage = Usd.Stage.Open(file_path)
+    skeleton = UsdSkel.Skeleton.Get(stage, f"/{root_prim_name}/{nodes[0].name}")
+    cache = UsdSkel.Cache()
+    query = cache.GetSkelQuery(skeleton)
+    assert query.GetAnimQuery()
+
+    # The animation starts at the rest pose, the sampled joints and the static ones falling back to the rest transforms
+    # have to agree on the scale of the translations
+    rest_transforms = skeleton.GetRestTransformsAttr().Get()
+    local_transforms = query.ComputeJointLocalTransforms(Usd.TimeCode(0))
+    assert len(local_transforms) == len(rest_transforms) == len(nodes)
+    for local_transform, rest_transform in zip(local_transforms, rest_transforms):
+        assert Gf.IsClose(local_transform, rest_transform, 1e-3)
+    assert not Gf.IsClose(rest_transforms[1].ExtractTranslation(), Gf.Vec3d(0.0, 40.0, 0.0), 1e-3)
+
+
+@pytest.fixture
+def animated_skin_fbx(fbx_defaults, request):
+    columns = getattr(request, "param", 5)
+    output_dir, manager, scene, fbx_file_format = fbx_defaults
+    times = [create_FbxTime(0), create_FbxTime(24)]
+    length = 10.0
+    with scenebuilder.SceneBuilder(manager, scene, output_dir) as builder:
+        builder.settings.file_format = fbx_file_format
+        builder.settings.anim_layers = ("Base",)
+
+        def rotation(end):
+            return Property(
+                name="LclRotation",
+                value=fbx.FbxDouble3(0.0, 0.0, 0.0),
+                animation_curves=[
+                    AnimationCurve(anim_layer="Base", times=times, values=[(0.0, 0.0, 0.0), end])
+                ],
+            )
+
+        a = Joint(name="A", is_root=True)
+        t = Transform(t=(length, 0.0, 0.0))
+        b = Joint(name="B", parent=a, transform=t, properties=[rotation((0.0, 0.0, 45.0))])
+        c = Joint(name="C", parent=b, transform=t, properties=[rotation((90.0, 0.0, 0.0))])
+        joints = (a, b, c)
+
+        # A strip along the joints, every column of points blends between the two joints closest to it
+        span = 2.0 * length / (columns - 1)
+        points = [p for i in range(columns) for p in ((i * span, 0, -1), (i * span, 0, 1))]
+        weights = [[] for _ in joints]
+        for i in range(columns):
+            position = i * (len(joints) - 1) / (columns - 1)
+            lower = min(int(position), len(joints) - 2)
+            blend = position - lower
+            for vertex in (2 * i, 2 * i + 1):
+                if blend < 1.0:
+                    weights[lower].append((vertex, 1.0 - blend))
+                if blend > 0.0:
+                    weights[lower + 1].append((vertex, blend))
+        polygons = [
+            polygon
+            for i in range(columns - 1)
+            for polygon in ((2 * i, 2 * i + 1, 2 * i + 3), (2 * i + 3, 2 * i + 2, 2 * i))
+        ]
+
+        geo = Mesh(
+            name="skin",
+            points=points,
+            polygons=polygons,
+            normals=MappedCoordinates(coordinates=[(0, 1, 0)], point_mapping=[0] * (3 * len(polygons))),
+            skinbinding=tuple(
+                SkinBinding(target_joint=joint, vertex_weights=tuple(joint_weights))
+                for joint, joint_weights in zip(joints, weights)
+            ),
+        )
+        builder.nodes.extend([a, b, c, geo])
+    yield str(builder.settings.file_path), builder.nodes
+
+
+def bake_with_usdskel(file_path):
+    stage = Usd.Stage.CreateInMemory()
+    stage.GetRootLayer().subLayerPaths.append(file_path)
+    assert UsdSkel.BakeSkinning(stage.Traverse())
+    return stage
+
+
+def test_baked_skinning(animated_skin_fbx, root_prim_name):
+    file_path, nodes = animated_skin_fbx
+    mesh_path = f"/{root_prim_name}/{nodes[-1].name}"
+    layer = Sdf.Layer.FindOrOpen(file_path, args={"bakeSkinning": "1"})
+    mesh = UsdGeom.Mesh.Get(Usd.Stage.Open(layer), mesh_path)
+    assert mesh
+
+    # The mesh is deformed by the plugin, there is nothing left for UsdSkel to do
+    assert not mesh.GetPrim().HasAPI(UsdSkel.BindingAPI)
+    assert not mesh.GetPrim().HasAttribute("primvars:skel:jointIndices")
+
+    points = mesh.GetPointsAttr()
+    assert points.GetNumTimeSamples() == 25
+
+    reference = UsdGeom.Mesh.Get(bake_with_usdskel(file_path), mesh_path).GetPointsAttr()
+    for frame in (0, 6, 12, 24):
+        expected_points = reference.Get(frame)
+        baked_points = points.Get(frame)
+        assert len(baked_points) == len(expected_points)
+        for expected, baked in zip(expected_points, baked_points):
+            assert Gf.IsClose(expected, baked, 1e-3)
+
+    normals = UsdGeom.PrimvarsAPI(mesh).GetPrimvar("normals")
+    assert normals.GetAttr().GetNumTimeSamples() == 25
+    face_vertex_indices = mesh.GetFaceVertexIndicesAttr().Get()
+    for point, normal in zip(face_vertex_indices, normals.Get(24)):
+        assert normal.GetLength() == pytest.approx(1.0, abs=1e-5)
+        # The first column only follows the root joint, which does not move
+        if point < 2:
+            assert Gf.IsClose(normal, Gf.Vec3f(0, 1, 0), 1e-5)
+
+
+@pytest.mark.benchmark
+@pytest.mark.parametrize("animated_skin_fbx", [5000], indirect=True)
+def test_baked_skinning_benchmark(animated_skin_fbx, root_prim_name):
+    file_path, nodes = animated_skin_fbx
+    mesh_path = f"/{root_prim_name}/{nodes[-1].name}"
+    frames = range(25)
+
+    start = time.perf_counter()
+    layer = Sdf.Layer.FindOrOpen(file_path, args={"bakeSkinning": "1"})
+    points = UsdGeom.Mesh.Get(Usd.Stage.Open(layer), mesh_path).GetPointsAttr()
+    baked = [points.Get(frame) for frame in frames]
+    baked_elapsed = time.perf_counter() - start
+
+    start = time.perf_counter()
+    reference = UsdGeom.Mesh.Get(bake_with_usdskel(file_path), mesh_path).GetPointsAttr()
+    expected = [reference.Get(frame) for frame in frames]
+    reference_elapsed = time.perf_counter() - start
+
+    speedup = reference_elapsed / baked_elapsed
+    print(
+        f"Skinned {len(baked[0])} points over {len(frames)} frames in {baked_elapsed:.3f}s with bakeSkinning, "
+        f"{reference_elapsed:.3f}s with UsdSkelBakeSkinning ({speedup:.2f}x)"
+    )
+
+    for expected_points, baked_points in zip(expected, baked):
+        assert len(baked_points) == len(expected_points)
+        for expected_point, baked_point in zip(expected_points, baked_points):
+            assert Gf.IsClose(expected_point, baked_point, 1e-3)
+    assert speedup > 1.0
+
+
+@pytest.fixture
+def blend_shapes_fbx(fbx_defaults):
+    output_dir, manager, scene, fbx_file_format = fbx_defaults
+    with scenebuilder.SceneBuilder(manager, scene, output_dir) as builder:
+        builder.settings.file_format = fbx_file_format
+        builder.settings.anim_layers = ("Base",)
+
+        points = [(0.0, 0.0, 0.0), (1.0, 0.0, 0.0), (1.0, 0.0, 1.0), (0.0, 0.0, 1.0)]
+
+        def moved(offsets):
+            return [
+                tuple(p + o for p, o in zip(point, offsets.get(i, (0.0, 0.0, 0.0))))
+                for i, point in enumerate(points)
+            ]
+
+        smile = BlendShapeChannel(
+            name="smile",
+            targets=[moved({0: (0.0, 1.0, 0.0), 1: (0.0, 1.0, 0.0)})],
+            full_weights=[100.0],
+            properties=[
+                Property(
+                    name="DeformPercent",
+                    value=0.0,
+                    animation_curves=[
+                        AnimationCurve(
+                            anim_layer="Base",
+                            times=[create_FbxTime(0), create_FbxTime(24)],
+                            values=[0.0, 100.0],
+                        )
+                    ],
+                )
+            ],
+        )
+        # The in-between moves further than halfway to the full target
+        blink = BlendShapeChannel(
+            name="blink",
+            targets=[moved({2: (0.0, 0.5, 0.0)}), moved({2: (0.0, 0.75, 0.0)})],
+            full_weights=[50.0, 100.0],
+        )
+        geo = Mesh(name="face", points=points, polygons=[(0, 1, 2, 3)], blendshapes=(smile, blink))
+        builder.nodes.append(geo)
+    yield str(builder.settings.file_path), builder.nodes
+
+
+def test_blend_shapes(blend_shapes_fbx, root_prim_name):
+    file_path, nodes = blend_shapes_fbx
+    mesh_path = f"/{root_prim_name}/{nodes[0].name}"
+    stage = Usd.Stage.Open(file_path)
+    mesh = stage.GetPrimAtPath(mesh_path)
+    assert mesh.HasAPI(UsdSkel.BindingAPI)
+
+    # The mesh is not skinned, a Skeleton without joints carries its weights
+    binding = UsdSkel.BindingAPI(mesh)
+    skeleton = binding.GetSkeleton()
+    assert skeleton.GetPath() == Sdf.Path(f"/{root_prim_name}/BlendShapes{nodes[0].name}")
+    assert list(skeleton.GetJointsAttr().Get()) == []
+
+    assert list(binding.GetBlendShapesAttr().Get()) == ["smile", "blink"]
+    assert binding.GetBlendShapeTargetsRel().GetTargets() == [
+        Sdf.Path(f"{mesh_path}/smile"),
+        Sdf.Path(f"{mesh_path}/blink"),
+    ]
+
+    # Only the points a channel moves are stored
+    smile = UsdSkel.BlendShape.Get(stage, f"{mesh_path}/smile")
+    assert list(smile.GetPointIndicesAttr().Get()) == [0, 1]
+    assert list(smile.GetOffsetsAttr().Get()) == [Gf.Vec3f(0, 1, 0)] * 2
+
+    blink = UsdSkel.BlendShape.Get(stage, f"{mesh_path}/blink")
+    assert list(blink.GetPointIndicesAttr().Get()) == [2]
+    assert list(blink.GetOffsetsAttr().Get()) == [Gf.Vec3f(0, 0.75, 0)]
+    inbetweens = blink.GetInbetweens()
+    assert len(inbetweens) == 1
+    assert inbetweens[0].GetWeight() == pytest.approx(0.5)
+    assert list(inbetweens[0].GetOffsets()) == [Gf.Vec3f(0, 0.5, 0)]
+
+    animation = UsdSkel.BindingAPI(skeleton.GetPrim()).GetAnimationSource()
+    animation = UsdSkel.Animation(animation)
+    assert list(animation.GetBlendShapesAttr().Get()) == ["smile", "blink"]
+    weights = animation.GetBlendShapeWeightsAttr()
+    assert weights.GetNumTimeSamples() == 25
+    assert list(weights.Get(0)) == pytest.approx([0.0, 0.0])
+    assert list(weights.Get(12)) == pytest.approx([0.5, 0.0], abs=1e-3)
+    assert list(weights.Get(24)) == pytest.approx([1.0, 0.0])
+
+    points = UsdGeom.Mesh.Get(bake_with_usdskel(file_path), mesh_path).GetPointsAttr()
+    for point, expected in zip(points.Get(24), [(0, 1, 0), (1, 1, 0), (1, 0, 1), (0, 0, 1)]):
+        assert Gf.IsClose(point, Gf.Vec3f(*expected), 1e-5)
+
+
+def test_blend_shape_value_clips(blend_shapes_fbx, root_prim_name):
+    file_path, nodes = blend_shapes_fbx
+    animation_path = f"/{root_prim_name}/AnimationBlendShapes{nodes[0].name}"
+
+    reference = UsdSkel.Animation.Get(Usd.Stage.Open(file_path), animation_path).GetBlendShapeWeightsAttr()
+
+    # The main layer and the manifest only sample a single frame, the weights have to be listed as animated for the
+    # clips to provide them
+    stage = Usd.Stage.Open(Sdf.Layer.FindOrOpen(file_path, args={"clipFrames": "8"}))
+    weights = UsdSkel.Animation.Get(stage, animation_path).GetBlendShapeWeightsAttr()
+    for time in reference.GetTimeSamples():
+        assert list(weights.Get(time)) == pytest.approx(list(reference.Get(time)), abs=1e-5)
@@ -1,9 +1,9 @@
 import pytest
 
 import FbxCommon as fbx
-from pxr import Usd, UsdGeom, Vt, Gf
+from pxr import Sdf, Usd, UsdGeom, Vt, Gf
 
-from data import Mesh, TransformableNode, Transform, scenebuilder, Node
+from data import Mesh, TransformableNode, Transform, scenebuilder, Node, Property
 from typing import List
 
 
@@ -131,3 +131,80 @@ def test_rotation_orders(rotation_orders_fbx, root_prim_name, capfd):
 
     rotation_order = xformAPI.GetXformVectors(Usd.TimeCode.Default())[4]
     assert rotation_order == expected
+
+
+@pytest.fixture(
+    params=[
+        # Rotating around a pivot moves the node
+        (
+            Transform(t=(10, 0, 0), r=(0, 0, 90)),
+            [Property(name="RotationPivot", value=fbx.FbxDouble3(1, 0, 0))],
+            (Gf.Vec3d(11, -1, 0), Gf.Vec3f(0, 0, 90)),
+        ),
+        # Pre rotations end up in the rotation
+        (
+            Transform(t=(10, 0, 0)),
+            [
+                Property(name="RotationActive", value=True),
+                Property(name="PreRotation", value=fbx.FbxDouble3(0, 0, 90)),
+            ],
+            (Gf.Vec3d(10, 0, 0), Gf.Vec3f(0, 0, 90)),
+        ),
+    ],
+    scope="session",
+    ids=["Rotation pivot", "Pre rotation"],
+)
+def pivoted_null_fbx(fbx_defaults, request):
+    output_dir, manager, scene, fbx_file_format = fbx_defaults
+    transform, properties, expected = request.param
+    with scenebuilder.SceneBuilder(manager, scene, output_dir) as builder:
+        builder.settings.file_format = fbx_file_format
+        builder.nodes.append(TransformableNode(name="null", transform=transform, properties=properties))
+    yield str(builder.settings.file_path), builder.nodes, expected
+
+
+def test_pivots_are_folded(pivoted_null_fbx, root_prim_name):
+    file_path, nodes, (expected_t, expected_r) = pivoted_null_fbx
+    stage = Usd.Stage.Open(file_path)
+    prim = stage.GetPrimAtPath(f"/{root_prim_name}/{nodes[0].name}")
+
+    # Pivots, offsets and pre/post rotations are folded into ops UsdGeomXformCommonAPI still understands
+    op_names = [op.GetOpName() for op in UsdGeom.Xformable(prim).GetOrderedXformOps()]
+    assert op_names == ["xformOp:translate", "xformOp:rotateXYZ", "xformOp:scale"]
+    xformAPI = UsdGeom.XformCommonAPI(prim)
+    t, r, *_ = xformAPI.GetXformVectors(Usd.TimeCode.Default())
+    assert Gf.IsClose(t, expected_t, 1e-5)
+    assert Gf.IsClose(r, expected_r, 1e-5)
+
+
+def test_static_transforms_are_collapsed(transformed_null_fbx, root_prim_name):
+    file_path, nodes = transformed_null_fbx
+    path = f"/{root_prim_name}/{nodes[0].name}"
+    decomposed = UsdGeom.Xformable(Usd.Stage.Open(file_path).GetPrimAtPath(path))
+    collapsed = UsdGeom.Xformable(
+        Usd.Stage.Open(Sdf.Layer.FindOrOpen(file_path, args={"collapseStaticXforms": "1"})).GetPrimAtPath(path)
+    )
+
+    assert [op.GetOpName() for op in collapsed.GetOrderedXformOps()] == ["xformOp:transform"]
+    assert Gf.IsClose(
+        collapsed.GetLocalTransformation(Usd.TimeCode.Default()),
+        decomposed.GetLocalTransformation(Usd.TimeCode.Default()),
+        1e-5,
+    )
+
+
+@pytest.fixture
+def identity_null_fbx(fbx_defaults):
+    output_dir, manager, scene, fbx_file_format = fbx_defaults
+    with scenebuilder.SceneBuilder(manager, scene, output_dir) as builder:
+        builder.settings.file_format = fbx_file_format
+        builder.nodes.append(TransformableNode(name="identity", transform=Transform()))
+    yield str(builder.settings.file_path), builder.nodes
+
+
+def test_identity_transforms_are_dropped(identity_null_fbx, root_prim_name):
+    file_path, nodes = identity_null_fbx
+    stage = Usd.Stage.Open(Sdf.Layer.FindOrOpen(file_path, args={"collapseStaticXforms": "1"}))
+    prim = stage.GetPrimAtPath(f"/{root_prim_name}/{nodes[0].name}")
+    assert prim.IsA(UsdGeom.Xform)
+    assert not UsdGeom.Xformable(prim).GetOrderedXformOps()